@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_stamp.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:28:17 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 16:28:17 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * Appends the CLOCK_MONOTONIC time it was exec'd at, in ns, to the file
+ * named by argv[1], then becomes cat. bench/launch.sh builds pipelines
+ * of it; the spread of the logged times is the exec skew
+ */
+int	main(int argc, char **argv)
+{
+	struct timespec	ts;
+	char			line[32];
+	int				len;
+	int				fd;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	if (argc < 2)
+		return (2);
+	len = snprintf(line, sizeof(line), "%lld\n",
+			(long long) ts.tv_sec * 1000000000LL + ts.tv_nsec);
+	fd = open(argv[1], O_WRONLY | O_CREAT | O_APPEND, 0644);
+	if (fd < 0 || write(fd, line, len) != len)
+		return (1);
+	close(fd);
+	execlp("cat", "cat", (char *) NULL);
+	return (127);
+}
@@ -0,0 +1,34 @@
+#!/bin/bash
+# Times `echo **/*.c` over a synthetic tree with 1 to N globstar workers.
+# usage: bench/globstar.sh [max_threads] [dirs] [files_per_dir]
+# MINISHELL overrides the binary under test (default ./minishell).
+
+set -e
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+MAX=${1:-$(nproc)}
+DIRS=${2:-2000}
+FILES=${3:-100}
+RUNS=3
+
+TREE=$(mktemp -d)
+trap 'rm -rf "$TREE"' EXIT
+for ((i = 0; i < DIRS; i++)); do
+	mkdir -p "$TREE/$((i / 50))/$i"
+	(cd "$TREE/$((i / 50))/$i" && touch $(seq -f "f%g.c" "$FILES"))
+done
+
+now_ms() { echo $(($(date +%s%N) / 1000000)); }
+
+printf '%-8s %-10s %s\n' threads best_ms matches
+for ((t = 1; t <= MAX; t++)); do
+	best=
+	for ((r = 0; r < RUNS; r++)); do
+		start=$(now_ms)
+		(cd "$TREE" && GLOBSTAR_THREADS=$t "$BIN" > /dev/null \
+			<<< "echo **/*.c > $TREE/out")
+		ms=$(($(now_ms) - start))
+		if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then best=$ms; fi
+	done
+	printf '%-8s %-10s %s\n' "$t" "$best" "$(wc -w < "$TREE/out")"
+done
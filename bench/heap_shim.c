@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heap_shim.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:07:27 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 18:07:27 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * LD_PRELOAD shim for bench/zygote.sh. The first line the shell puts in
+ * its history grows its heap by HEAP_SHIM_MB MiB (default 1024) of
+ * touched memory. That happens after --zygote has forked its helper, so
+ * only the shell itself is big
+ */
+void	add_history(const char *line)
+{
+	static void	(*real)(const char *);
+	static int	grown;
+	char		*mem;
+	size_t		len;
+
+	if (!grown)
+	{
+		grown = 1;
+		len = 1024;
+		if (getenv("HEAP_SHIM_MB") && atoi(getenv("HEAP_SHIM_MB")) > 0)
+			len = atoi(getenv("HEAP_SHIM_MB"));
+		len <<= 20;
+		mem = malloc(len);
+		if (mem)
+			memset(mem, 1, len);
+	}
+	if (!real)
+		real = (void (*)(const char *)) dlsym(RTLD_NEXT, "add_history");
+	if (real)
+		real(line);
+}
@@ -0,0 +1,50 @@
+#!/bin/bash
+# Runs a pipeline of bench/exec_stamp stages under LAUNCH_STATS and
+# reports medians: exec_skew is the spread of the times the stages were
+# exec'd at, plan and fork skew are what the shell printed (empty for
+# a shell without LAUNCH_STATS).
+# usage: bench/launch.sh [stages] [runs] [expand]
+# With expand set, every stage also gets "$HOME"/x*y ${PATH%%:*}.
+# MINISHELL overrides the binary under test (default ./minishell).
+
+set -e
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+STAGES=${1:-100}
+RUNS=${2:-25}
+EXTRA=
+[ -n "$3" ] && EXTRA=' "$HOME"/x*y ${PATH%%:*}'
+
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cc -O2 -Wall -Wextra -Werror bench/exec_stamp.c -o "$DIR/exec_stamp"
+
+line="$DIR/exec_stamp $DIR/log$EXTRA < /dev/null"
+for ((i = 1; i < STAGES; i++)); do
+	line+=" | $DIR/exec_stamp $DIR/log$EXTRA"
+done
+echo "$line > /dev/null" > "$DIR/script"
+
+median() { sort -n | awk '{ v[NR] = $1 } END { print v[int((NR + 1) / 2)] }'; }
+us_to_ms() { awk '{ printf "%.1f", $1 / 1000 }'; }
+
+for ((r = 0; r < RUNS; r++)); do
+	rm -f "$DIR/log"
+	start=$(date +%s%N)
+	LAUNCH_STATS=1 "$BIN" < "$DIR/script" > /dev/null 2> "$DIR/stats"
+	echo $((($(date +%s%N) - start) / 1000)) >> "$DIR/wall"
+	sort -n "$DIR/log" \
+		| awk 'NR == 1 { a = $1 } END { print int(($1 - a) / 1000) }' \
+		>> "$DIR/exec"
+	sed -n 's/.*planned in \([0-9]*\) us, skew \([0-9]*\) us/\1 \2/p' \
+		"$DIR/stats" > "$DIR/last"
+	cut -d' ' -f1 "$DIR/last" >> "$DIR/plan"
+	cut -d' ' -f2 "$DIR/last" >> "$DIR/fork"
+	[ "$(wc -l < "$DIR/log")" = "$STAGES" ] || { echo "stages missing"; exit 1; }
+done
+
+printf '%-10s %-12s %-10s %-14s %s\n' stages exec_skew_ms wall_ms \
+	plan_ms fork_skew_ms
+printf '%-10s %-12s %-10s %-14s %s\n' "$STAGES" \
+	"$(median < "$DIR/exec" | us_to_ms)" "$(median < "$DIR/wall" | us_to_ms)" \
+	"$(median < "$DIR/plan" | us_to_ms)" "$(median < "$DIR/fork" | us_to_ms)"
@@ -0,0 +1,48 @@
+#!/bin/bash
+# Wall time of the same CPU-bound jobs run one after another by a serial
+# loop and by `parallel -j N` for N = 1 to max_jobs. Each job is an awk
+# loop of `work` iterations. Best of 3 runs.
+# usage: bench/parallel.sh [max_jobs] [jobs] [work]
+# MINISHELL overrides the binary under test (default ./minishell).
+
+set -e
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+MAX=${1:-$(nproc)}
+JOBS=${2:-16}
+WORK=${3:-3000000}
+RUNS=3
+
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+JOB='awk "BEGIN { for (i = 0; i < {}; i++) s += i; print s }"'
+ARGS=$(for ((i = 0; i < JOBS; i++)); do printf ' %s' "$WORK"; done)
+for ((i = 0; i < JOBS; i++)); do echo "${JOB//\{\}/$WORK}"; done \
+	> "$DIR/serial"
+
+now_ms() { echo $(($(date +%s%N) / 1000000)); }
+
+# best SCRIPT: prints the best wall time in ms, and fails unless every
+# job printed its result
+best() {
+	local best= ms r
+
+	for ((r = 0; r < RUNS; r++)); do
+		ms=$(now_ms)
+		"$BIN" < "$1" > "$DIR/out"
+		ms=$(($(now_ms) - ms))
+		if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then best=$ms; fi
+	done
+	[ "$(grep -c '^[0-9]' "$DIR/out")" = "$JOBS" ] || return 1
+	echo "$best"
+}
+
+serial=$(best "$DIR/serial") || { echo "serial: jobs missing"; exit 1; }
+printf '%-12s %-10s %s\n' mode best_ms speedup
+printf '%-12s %-10s %s\n' serial "$serial" 1.00
+for ((j = 1; j <= MAX; j++)); do
+	echo "parallel -j $j $JOB :::$ARGS" > "$DIR/par"
+	ms=$(best "$DIR/par") || { echo "-j $j: jobs missing"; exit 1; }
+	printf '%-12s %-10s %s\n' "-j $j" "$ms" \
+		"$(awk -v a="$serial" -v b="$ms" 'BEGIN { printf "%.2f", a / b }')"
+done
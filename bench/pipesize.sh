@@ -0,0 +1,47 @@
+#!/bin/bash
+# Wall time of moving a file through `cat src | cat | wc -c` without
+# PIPESIZE and with each given PIPESIZE. Best of 3 runs.
+# usage: bench/pipesize.sh [size_mb] [pipesize...]
+# MINISHELL overrides the binary under test (default ./minishell).
+
+set -e
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+SIZE_MB=${1:-512}
+shift || true
+SIZES=("$@")
+[ ${#SIZES[@]} -gt 0 ] || SIZES=(64k 256k 1M)
+RUNS=3
+
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+head -c "$((SIZE_MB << 20))" /dev/urandom > "$DIR/src"
+
+now_ms() { echo $(($(date +%s%N) / 1000000)); }
+
+# run [PIPESIZE]: prints the best wall time in ms, and fails unless
+# every byte came through
+run() {
+	local best= ms r
+
+	{
+		[ -z "$1" ] || echo "export PIPESIZE=$1"
+		echo "cat $DIR/src | cat | wc -c"
+	} > "$DIR/script"
+	for ((r = 0; r < RUNS; r++)); do
+		ms=$(now_ms)
+		"$BIN" < "$DIR/script" > "$DIR/out"
+		ms=$(($(now_ms) - ms))
+		if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then best=$ms; fi
+	done
+	grep -q "^ *$((SIZE_MB << 20))$" "$DIR/out" || return 1
+	echo "$best"
+}
+
+printf '%-10s %-10s %s\n' PIPESIZE best_ms MiB_per_s
+for size in unset "${SIZES[@]}"; do
+	arg=$size
+	[ "$size" != unset ] || arg=
+	ms=$(run "$arg") || { echo "$size: bytes missing"; exit 1; }
+	printf '%-10s %-10s %s\n' "$size" "$ms" $((SIZE_MB * 1000 / ms))
+done
@@ -0,0 +1,49 @@
+#!/bin/bash
+# Commands per second through a fresh shell, a minishell_client call per
+# command, and minishell_client calls carrying 100 commands each.
+# usage: bench/server.sh [commands] [command]
+# MINISHELL and MINISHELL_CLIENT override the binaries under test.
+
+set -e
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+CLIENT=${MINISHELL_CLIENT:-$PWD/minishell_client}
+N=${1:-500}
+CMD=${2:-true}
+BATCH=100
+
+DIR=$(mktemp -d)
+SOCK=$DIR/sock
+"$BIN" --server "$SOCK" > /dev/null 2>&1 &
+SERVER=$!
+trap 'kill $SERVER 2> /dev/null; rm -rf "$DIR"' EXIT
+while [ ! -S "$SOCK" ]; do sleep 0.05; done
+
+now_ms() { echo $(($(date +%s%N) / 1000000)); }
+
+report() {
+	local ms=$(($(now_ms) - $2))
+	[ "$ms" -gt 0 ] || ms=1
+	printf '%-12s %-10s %s\n' "$1" "$ms" $((N * 1000 / ms))
+}
+
+printf '%-12s %-10s %s\n' mode ms per_sec
+start=$(now_ms)
+for ((i = 0; i < N; i++)); do
+	"$BIN" <<< "$CMD" > /dev/null
+done
+report fresh "$start"
+
+start=$(now_ms)
+for ((i = 0; i < N; i++)); do
+	"$CLIENT" "$SOCK" "$CMD" > /dev/null
+done
+report client "$start"
+
+start=$(now_ms)
+for ((i = 0; i < N; i += BATCH)); do
+	ARGS=()
+	for ((j = i; j < N && j < i + BATCH; j++)); do ARGS+=("$CMD"); done
+	"$CLIENT" "$SOCK" "${ARGS[@]}" > /dev/null
+done
+report batch_$BATCH "$start"
@@ -0,0 +1,45 @@
+#!/bin/bash
+# Per-command cost of running /bin/true from a script, with the shell
+# forking each command and with --zygote, first with the shell's own
+# small heap and then with heap_mb MiB more (bench/heap_shim.c grows it
+# once the helper is up). Best of 3 runs.
+# usage: bench/zygote.sh [commands] [heap_mb]
+# MINISHELL overrides the binary under test (default ./minishell).
+
+set -e
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+N=${1:-300}
+HEAP_MB=${2:-1024}
+RUNS=3
+
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cc -O2 -Wall -Wextra -Werror -D_GNU_SOURCE -shared -fPIC \
+	bench/heap_shim.c -o "$DIR/heap_shim.so" -ldl
+{
+	echo 'unset LD_PRELOAD'
+	for ((i = 0; i < N; i++)); do echo /bin/true; done
+} > "$DIR/script"
+
+now_us() { echo $(($(date +%s%N) / 1000)); }
+
+# run PRELOAD FLAG...: prints the best time per command, in ms
+run() {
+	local preload=$1 best= us r
+
+	shift
+	for ((r = 0; r < RUNS; r++)); do
+		us=$(now_us)
+		LD_PRELOAD=$preload HEAP_SHIM_MB=$HEAP_MB "$BIN" "$@" \
+			< "$DIR/script" > /dev/null
+		us=$(($(now_us) - us))
+		if [ -z "$best" ] || [ "$us" -lt "$best" ]; then best=$us; fi
+	done
+	awk -v us="$best" -v n="$N" 'BEGIN { printf "%.2f", us / n / 1000 }'
+}
+
+printf '%-10s %-12s %s\n' heap fork_ms zygote_ms
+printf '%-10s %-12s %s\n' small "$(run '')" "$(run '' --zygote)"
+printf '%-10s %-12s %s\n' "${HEAP_MB}M" "$(run "$DIR/heap_shim.so")" \
+	"$(run "$DIR/heap_shim.so" --zygote)"
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_cat.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:20:19 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 17:20:19 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * The registry entry; the deferred stage in the shell calls builtin_cat
+ * directly with its own command
+ */
+int	run_builtin_cat(t_cmd_ctx *cmd_ctx)
+{
+	return (builtin_cat(cmd_ctx->current));
+}
+
+static int	cat_error(const char *name, const char *msg)
+{
+	if (errno == EPIPE)
+		return (128 + SIGPIPE);
+	if (errno == EINTR)
+		return (130);
+	ft_fprintf_fd(2, "minishell: cat: %s: %s\n", name, msg);
+	return (1);
+}
+
+static int	is_output_file(int fd)
+{
+	struct stat	in_st;
+	struct stat	out_st;
+
+	if (fstat(fd, &in_st) == -1 || fstat(STDOUT_FILENO, &out_st) == -1)
+		return (0);
+	return (S_ISREG(in_st.st_mode) && in_st.st_dev == out_st.st_dev
+		&& in_st.st_ino == out_st.st_ino && out_st.st_size > 0);
+}
+
+static int	cat_one(const char *name)
+{
+	int	fd;
+	int	status;
+
+	fd = STDIN_FILENO;
+	if (ft_strcmp(name, "-") != 0)
+		fd = open(name, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return (cat_error(name, strerror(errno)));
+	status = 0;
+	errno = 0;
+	if (is_output_file(fd))
+		status = cat_error(name, "input file is output file");
+	else if (cat_copy(fd, STDOUT_FILENO) == -1)
+		status = cat_error(name, strerror(errno));
+	if (fd != STDIN_FILENO)
+		close(fd);
+	return (status);
+}
+
+int	builtin_cat(t_command *cmd)
+{
+	int	i;
+	int	status;
+	int	ret;
+
+	if (cmd->args_count < 2)
+		return (cat_one("-"));
+	status = 0;
+	i = 0;
+	while (++i < cmd->args_count)
+	{
+		ret = cat_one(cmd->args[i]);
+		if (ret == 128 + SIGPIPE || ret == 130)
+			return (ret);
+		if (ret)
+			status = ret;
+	}
+	return (status);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_cat_copy.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:02:38 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 16:02:38 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	is_unsupported(int err)
+{
+	return (err == EINVAL || err == ENOSYS || err == EXDEV || err == EBADF
+		|| err == EOPNOTSUPP);
+}
+
+static ssize_t	zero_copy_step(int in, int out, int method)
+{
+	if (method == CAT_RANGE)
+		return (copy_file_range(in, NULL, out, NULL, CAT_CHUNK, 0));
+	if (method == CAT_SENDFILE)
+		return (sendfile(out, in, NULL, CAT_CHUNK));
+	return (splice(in, NULL, out, NULL, CAT_CHUNK,
+			SPLICE_F_MOVE | SPLICE_F_MORE));
+}
+
+/*
+ * The kernel refuses some descriptor pairs only on the first call; that
+ * case reports CAT_UNSUPPORTED so the caller can try the next method.
+ * A Ctrl-C taken by the shell stops the copy between chunks with EINTR
+ */
+static int	copy_loop(int in, int out, int method)
+{
+	ssize_t	n;
+	int		first;
+
+	first = 1;
+	while (!shell_interrupted())
+	{
+		n = zero_copy_step(in, out, method);
+		if (n == 0)
+			return (0);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n < 0 && first && is_unsupported(errno))
+			return (CAT_UNSUPPORTED);
+		if (n < 0)
+			return (-1);
+		first = 0;
+	}
+	errno = EINTR;
+	return (-1);
+}
+
+static int	copy_by_rw(int in, int out)
+{
+	char	*buf;
+	ssize_t	n;
+
+	buf = malloc(CAT_CHUNK);
+	if (!buf)
+		return (-1);
+	while (1)
+	{
+		n = -1;
+		errno = EINTR;
+		if (shell_interrupted())
+			break ;
+		n = read(in, buf, CAT_CHUNK);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0 || write_all(out, buf, n) == -1)
+			break ;
+	}
+	free(buf);
+	if (n == 0)
+		return (0);
+	return (-1);
+}
+
+/*
+ * Copies in to out without going through user space when the kernel
+ * can: copy_file_range between regular files, sendfile out of a regular
+ * file, splice when either end is a pipe
+ */
+int	cat_copy(int in, int out)
+{
+	struct stat	in_st;
+	struct stat	out_st;
+	int			ret;
+
+	if (fstat(in, &in_st) == -1 || fstat(out, &out_st) == -1)
+		return (copy_by_rw(in, out));
+	ret = CAT_UNSUPPORTED;
+	if (S_ISREG(in_st.st_mode) && S_ISREG(out_st.st_mode))
+		ret = copy_loop(in, out, CAT_RANGE);
+	if (ret == CAT_UNSUPPORTED && S_ISREG(in_st.st_mode))
+		ret = copy_loop(in, out, CAT_SENDFILE);
+	if (ret == CAT_UNSUPPORTED && (S_ISFIFO(in_st.st_mode)
+			|| S_ISFIFO(out_st.st_mode)))
+		ret = copy_loop(in, out, CAT_SPLICE);
+	if (ret == CAT_UNSUPPORTED)
+		ret = copy_by_rw(in, out);
+	return (ret);
+}
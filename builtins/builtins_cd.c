@@ -69,23 +69,23 @@ static char	*get_target_dir(t_command *cmd, t_env **env, char *old_pwd)
 	return (dir);
 }
 
-int	builtin_cd(t_command *cmd, t_env **env)
+int	builtin_cd(t_cmd_ctx *cmd_ctx)
 {
 	char	*old_pwd;
 	char	*dir;
 	int		ret;
 
 	old_pwd = getcwd(NULL, 0);
-	if (cmd->args_count > 2)
+	if (cmd_ctx->current->args_count > 2)
 	{
 		safe_free((void **)&old_pwd);
 		return (ft_fprintf_fd(2, "minishell: cd: too many arguments\n"), 1);
 	}
-	dir = get_target_dir(cmd, env, old_pwd);
+	dir = get_target_dir(cmd_ctx->current, cmd_ctx->env_list, old_pwd);
 	if (!dir)
 		return (1);
 	ret = chdir(dir);
 	if (ret != 0)
 		return (handle_cd_errors(dir, old_pwd));
-	return (update_pwd_vars(env, old_pwd));
+	return (update_pwd_vars(cmd_ctx->env_list, old_pwd));
 }
@@ -28,11 +28,13 @@ static int	is_valid_n_flag(char *arg)
 	return (1);
 }
 
-int	builtin_echo(t_command *cmd)
+int	builtin_echo(t_cmd_ctx *cmd_ctx)
 {
-	int	i;
-	int	print_newline;
+	t_command	*cmd;
+	int			i;
+	int			print_newline;
 
+	cmd = cmd_ctx->current;
 	i = 1;
 	print_newline = 1;
 	while (i < cmd->args_count && is_valid_n_flag(cmd->args[i]))
@@ -89,16 +89,18 @@ static int	handle_cmd_exec(t_command *cmd, t_env *env_list, int first_cmd_arg)
 	return (0);
 }
 
-int	builtin_env(t_command *cmd, t_env *env_list)
+int	builtin_env(t_cmd_ctx *cmd_ctx)
 {
-	int	first_cmd_arg;
+	t_command	*cmd;
+	int			first_cmd_arg;
 
+	cmd = cmd_ctx->current;
 	first_cmd_arg = 1;
 	while (first_cmd_arg < cmd->args_count
 		&& is_env_var_format(cmd->args[first_cmd_arg]))
 		first_cmd_arg++;
 	if (first_cmd_arg < cmd->args_count)
-		return (handle_cmd_exec(cmd, env_list, first_cmd_arg));
-	print_environment(env_list, cmd);
+		return (handle_cmd_exec(cmd, *cmd_ctx->env_list, first_cmd_arg));
+	print_environment(*cmd_ctx->env_list, cmd);
 	return (0);
 }
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_exec.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:39:27 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 13:39:27 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static void	record_exec_fds(t_command *cmd)
+{
+	t_redirections	*redir;
+	int				fd;
+
+	redir = cmd->redirections;
+	while (redir)
+	{
+		fd = redirect_target_fd(redir);
+		if (fd > STDERR_FILENO && fd < REDIRECT_FRAME_MIN_FD)
+		{
+			if ((redir->type == TOKEN_DUP_IN || redir->type == TOKEN_DUP_OUT)
+				&& ft_strcmp(redir->file, "-") == 0)
+				*user_fds() &= ~(1U << fd);
+			else
+				*user_fds() |= 1U << fd;
+		}
+		redir = redir->next;
+	}
+}
+
+/*
+ * Also used by `timeout`, which is likewise followed by the command it
+ * runs
+ */
+void	drop_first_word(t_command *cmd)
+{
+	safe_free((void **)&cmd->args[0]);
+	ft_memmove(cmd->args, cmd->args + 1, sizeof(char *) * cmd->args_count);
+	cmd->args_count--;
+}
+
+/*
+ * With only redirections, exec keeps them in the shell: the caller
+ * commits the redirect frame instead of restoring it. With a command,
+ * the command replaces the shell
+ */
+int	builtin_exec(t_cmd_ctx *cmd_ctx)
+{
+	t_command	*cmd;
+
+	cmd = cmd_ctx->current;
+	if (cmd->args_count < 2)
+	{
+		record_exec_fds(cmd);
+		return (0);
+	}
+	drop_first_word(cmd);
+	reset_child_signals();
+	if (command_builtin(cmd))
+		exit(execute_builtin(cmd_ctx));
+	handle_external_command(cmd_ctx);
+	return (127);
+}
@@ -50,6 +50,7 @@ int	builtin_exit(t_cmd_ctx *cmd_ctx)
 	}
 	free_command_list(cmd_ctx->cmd_list);
 	free_env_list(cmd_ctx->env_list);
+	arith_cache_clear();
 	clear_history();
 	exit(exit_status);
 }
@@ -12,21 +12,23 @@
 
 #include "../minishell.h"
 
-int	builtin_export(t_command *cmd, t_env **env_list)
+int	builtin_export(t_cmd_ctx *cmd_ctx)
 {
-	int	i;
-	int	fail;
+	t_command	*cmd;
+	int			i;
+	int			fail;
 
+	cmd = cmd_ctx->current;
 	fail = 0;
 	if (!cmd->args[1])
 	{
-		print_export_list(*env_list);
+		print_export_list(*cmd_ctx->env_list);
 		return (0);
 	}
 	i = 1;
 	while (cmd->args[i])
 	{
-		if (!export_one_arg(cmd->args[i], env_list))
+		if (!export_one_arg(cmd->args[i], cmd_ctx->env_list))
 			fail = 1;
 		i++;
 	}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_parallel.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:09:45 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 18:09:45 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	parse_limit(t_command *cmd, int *i, int *limit)
+{
+	char	*value;
+
+	value = cmd->args[*i] + 2;
+	if (*value == '\0' && ++(*i) < cmd->args_count)
+		value = cmd->args[*i];
+	if (!is_number(value) || ft_atoi(value) < 1)
+	{
+		ft_fprintf_fd(2, "minishell: parallel: -j: invalid job count\n");
+		return (-1);
+	}
+	*limit = ft_atoi(value);
+	(*i)++;
+	return (0);
+}
+
+/*
+ * Without `:::`, one job per line of stdin
+ */
+static int	read_stdin_inputs(t_strvec *lines)
+{
+	t_subst_buf	data;
+	char		**split;
+	int			i;
+
+	ft_bzero(&data, sizeof(data));
+	if (!subst_read_fd(STDIN_FILENO, &data))
+		return (safe_free((void **)&data.data), -1);
+	split = ft_split(data.data, '\n');
+	safe_free((void **)&data.data);
+	if (!split)
+		return (-1);
+	i = -1;
+	while (split[++i])
+	{
+		if (!strvec_push(lines, split[i]))
+			return (safe_doube_star_free(split + i), -1);
+	}
+	free(split);
+	return (0);
+}
+
+static int	setup_inputs(t_command *cmd, int i, t_parallel *p, t_strvec *lines)
+{
+	p->tmpl = cmd->args + i;
+	while (i < cmd->args_count && ft_strcmp(cmd->args[i], PARALLEL_SEP))
+		i++;
+	p->tmpl_count = cmd->args + i - p->tmpl;
+	if (p->tmpl_count == 0)
+		return (ft_fprintf_fd(2, "minishell: parallel: missing command\n"),
+			-1);
+	if (i < cmd->args_count)
+	{
+		p->inputs = cmd->args + i + 1;
+		p->count = cmd->args_count - i - 1;
+		return (0);
+	}
+	if (read_stdin_inputs(lines) == -1)
+		return (ft_fprintf_fd(2, "minishell: parallel: %s\n",
+				strerror(errno)), -1);
+	p->inputs = lines->items;
+	p->count = lines->count;
+	return (0);
+}
+
+int	parallel_watch(int epfd, int fd, uint64_t key)
+{
+	struct epoll_event	add;
+
+	add.events = EPOLLIN;
+	add.data.u64 = key;
+	return (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &add));
+}
+
+/*
+ * `parallel [-j N] cmd [args] [::: inputs...]` runs cmd once per input,
+ * with `{}` in its words replaced by the input or, without `{}`, the
+ * input added as a last word. N jobs, one per CPU by default, run at a
+ * time. Output is printed in input order and the status is the number
+ * of jobs that failed
+ */
+int	builtin_parallel(t_cmd_ctx *cmd_ctx)
+{
+	t_parallel	p;
+	t_strvec	lines;
+	int			i;
+
+	ft_bzero(&p, sizeof(p));
+	ft_bzero(&lines, sizeof(lines));
+	p.ctx = cmd_ctx;
+	p.limit = sysconf(_SC_NPROCESSORS_ONLN);
+	i = 1;
+	if (i < cmd_ctx->current->args_count
+		&& ft_strncmp(cmd_ctx->current->args[i], "-j", 2) == 0
+		&& parse_limit(cmd_ctx->current, &i, &p.limit) == -1)
+		return (2);
+	if (setup_inputs(cmd_ctx->current, i, &p, &lines) == -1)
+		return (strvec_free(&lines), 2);
+	i = parallel_run(&p);
+	strvec_free(&lines);
+	if (i == -1)
+		return (1);
+	if (p.stop)
+		return (130);
+	if (p.failed > PARALLEL_MAX_FAILED)
+		return (PARALLEL_MAX_FAILED);
+	return (p.failed);
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_parallel_job.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:40:05 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 14:40:05 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Copies word with every `{}` replaced by input
+ */
+static char	*substitute(const char *word, const char *input)
+{
+	t_subst_buf	out;
+	const char	*hole;
+	size_t		len;
+
+	ft_bzero(&out, sizeof(out));
+	while (1)
+	{
+		len = ft_strlen(word);
+		hole = ft_strnstr(word, "{}", len);
+		if (hole)
+			len = hole - word;
+		if (!subst_buf_reserve(&out, len + ft_strlen(input)))
+			return (safe_free((void **)&out.data), NULL);
+		ft_memcpy(out.data + out.len, word, len);
+		out.len += len;
+		if (!hole)
+			break ;
+		ft_memcpy(out.data + out.len, input, ft_strlen(input));
+		out.len += ft_strlen(input);
+		word = hole + 2;
+	}
+	out.data[out.len] = '\0';
+	return (out.data);
+}
+
+/*
+ * Built in the child, which exits without having to free it
+ */
+static t_command	*job_command(t_parallel *p, const char *input)
+{
+	t_command	*cmd;
+	int			holes;
+
+	cmd = command_init();
+	if (cmd)
+		cmd->args = malloc(sizeof(char *) * (p->tmpl_count + 2));
+	if (!cmd || !cmd->args)
+		return (NULL);
+	holes = 0;
+	while (cmd->args_count < p->tmpl_count)
+	{
+		if (ft_strnstr(p->tmpl[cmd->args_count], "{}",
+				ft_strlen(p->tmpl[cmd->args_count])))
+			holes = 1;
+		cmd->args[cmd->args_count] = substitute(p->tmpl[cmd->args_count],
+				input);
+		if (!cmd->args[cmd->args_count++])
+			return (NULL);
+	}
+	if (!holes)
+		cmd->args[cmd->args_count++] = ft_strdup(input);
+	cmd->args[cmd->args_count] = NULL;
+	if (!cmd->args[cmd->args_count - 1])
+		return (NULL);
+	return (cmd);
+}
+
+static void	job_child(t_parallel *p, int index, int out)
+{
+	t_cmd_ctx	ctx;
+
+	reset_child_signals();
+	if (dup2(out, STDOUT_FILENO) == -1)
+		exit(1);
+	close_shell_fds(NULL);
+	ft_bzero(&ctx, sizeof(ctx));
+	ctx.env_list = p->ctx->env_list;
+	ctx.current = job_command(p, p->inputs[index]);
+	if (!ctx.current)
+		exit(1);
+	ctx.cmd_list = ctx.current;
+	ctx.pipe_fd[0] = -1;
+	ctx.pipe_fd[1] = -1;
+	ctx.prev_pipe_read = -1;
+	execute_single_command(&ctx);
+	exit(127);
+}
+
+/*
+ * Without a fork there is nothing left to start: the jobs not run yet
+ * count as failed
+ */
+static void	spawn_failed(t_parallel *p, int fds[2])
+{
+	ft_fprintf_fd(2, "minishell: parallel: %s\n", strerror(errno));
+	if (fds)
+		close(fds[0]);
+	if (fds)
+		close(fds[1]);
+	p->failed += p->count - p->next;
+	p->count = p->next;
+}
+
+/*
+ * Starts the next job with its stdout on a pipe. Both the pipe and the
+ * pidfd go in the epoll set, keyed by job index; without pidfd_open the
+ * job is waited for once its output ends
+ */
+int	parallel_spawn(t_parallel *p)
+{
+	t_job	*job;
+	int		fds[2];
+
+	job = &p->jobs[p->next];
+	if (pipe2(fds, O_CLOEXEC) == -1)
+		return (spawn_failed(p, NULL), -1);
+	job->pid = fork();
+	if (job->pid == -1)
+		return (spawn_failed(p, fds), -1);
+	if (job->pid == 0)
+		job_child(p, p->next, fds[1]);
+	close(fds[1]);
+	job->out = move_fd_high(fds[0]);
+	job->pidfd = move_fd_high(syscall(SYS_pidfd_open, job->pid, 0));
+	if (job->pidfd >= 0 && parallel_watch(p->epfd, job->pidfd,
+			((uint64_t)p->next << 1) | 1) == -1)
+	{
+		close(job->pidfd);
+		job->pidfd = -1;
+	}
+	if (parallel_watch(p->epfd, job->out, (uint64_t)p->next << 1) == -1)
+		safe_close(&job->out);
+	p->next++;
+	p->running++;
+	return (0);
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_parallel_loop.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:45:12 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:12 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * The job next in line streams straight to stdout; the others keep
+ * their output until it is their turn
+ */
+static void	job_read(t_parallel *p, int index)
+{
+	t_job	*job;
+	ssize_t	n;
+
+	job = &p->jobs[index];
+	if (!subst_buf_reserve(&job->buf, PARALLEL_READ))
+		n = -1;
+	else
+		n = read(job->out, job->buf.data + job->buf.len, PARALLEL_READ);
+	if (n < 0 && errno == EINTR)
+		return ;
+	if (n <= 0)
+	{
+		epoll_ctl(p->epfd, EPOLL_CTL_DEL, job->out, NULL);
+		safe_close(&job->out);
+		return ;
+	}
+	if (index != p->flushed)
+		job->buf.len += n;
+	else
+		write_all(STDOUT_FILENO, job->buf.data + job->buf.len, n);
+}
+
+static void	job_reap(t_parallel *p, int index)
+{
+	t_job	*job;
+	int		status;
+
+	job = &p->jobs[index];
+	status = 0;
+	while (waitpid(job->pid, &status, 0) == -1)
+	{
+		if (errno != EINTR)
+			break ;
+	}
+	if (WIFEXITED(status))
+		job->status = WEXITSTATUS(status);
+	else
+		job->status = 128 + WTERMSIG(status);
+	if (job->status != 0)
+		p->failed++;
+	if (job->pidfd >= 0)
+		epoll_ctl(p->epfd, EPOLL_CTL_DEL, job->pidfd, NULL);
+	if (job->pidfd >= 0)
+		close(job->pidfd);
+	job->pidfd = -1;
+	job->pid = 0;
+	p->running--;
+}
+
+/*
+ * Prints what the finished jobs at the head of the line collected, then
+ * whatever the new head has buffered so far
+ */
+static void	flush_ready(t_parallel *p)
+{
+	t_job	*job;
+
+	while (p->flushed < p->next)
+	{
+		job = &p->jobs[p->flushed];
+		if (job->buf.len)
+			write_all(STDOUT_FILENO, job->buf.data, job->buf.len);
+		job->buf.len = 0;
+		if (job->out >= 0)
+			return ;
+		if (job->pid && job->pidfd >= 0)
+			return ;
+		if (job->pid)
+			job_reap(p, p->flushed);
+		safe_free((void **)&job->buf.data);
+		p->flushed++;
+	}
+}
+
+static void	handle_key(t_parallel *p, uint64_t key)
+{
+	int	i;
+
+	if (key == PARALLEL_KEY_SIGNAL)
+	{
+		if (events_drain_signals() != SIGINT || p->stop)
+			return ;
+		p->stop = 1;
+		i = p->flushed - 1;
+		while (++i < p->next)
+		{
+			if (p->jobs[i].pid)
+				kill(p->jobs[i].pid, SIGINT);
+		}
+	}
+	else if (key & 1)
+		job_reap(p, key >> 1);
+	else
+		job_read(p, key >> 1);
+}
+
+/*
+ * Keeps `limit` jobs running until the inputs run out or SIGINT arrives,
+ * and returns once every started job was reaped and printed. SIGINT only
+ * reaches the signalfd when parallel runs in the shell itself
+ */
+int	parallel_run(t_parallel *p)
+{
+	struct epoll_event	events[EVENTS_MAX];
+	int					n;
+
+	p->jobs = ft_calloc(p->count + 1, sizeof(t_job));
+	p->epfd = move_fd_high(epoll_create1(EPOLL_CLOEXEC));
+	if (!p->jobs || p->epfd < 0)
+		return (safe_free((void **)&p->jobs), -1);
+	if (shell_events()->sigfd > 0)
+		parallel_watch(p->epfd, shell_events()->sigfd, PARALLEL_KEY_SIGNAL);
+	while (1)
+	{
+		while (!p->stop && p->next < p->count && p->running < p->limit)
+			parallel_spawn(p);
+		if (p->flushed >= p->next)
+			break ;
+		n = epoll_wait(p->epfd, events, EVENTS_MAX, -1);
+		while (n-- > 0)
+			handle_key(p, events[n].data.u64);
+		flush_ready(p);
+	}
+	close(p->epfd);
+	safe_free((void **)&p->jobs);
+	return (0);
+}
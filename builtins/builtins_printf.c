@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_printf.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:00:10 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 14:00:10 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Missing arguments read as empty strings, which convert to 0
+ */
+char	*printf_arg(t_printf *p)
+{
+	if (p->next >= p->count)
+		return ("");
+	return (p->args[p->next++]);
+}
+
+/*
+ * Errors are not held back with the output, so like bash they show up
+ * ahead of the text the builtin has gathered so far
+ */
+void	printf_error(t_printf *p, char *word, char *msg)
+{
+	if (word)
+		ft_fprintf_fd(2, "minishell: printf: %s: %s\n", word, msg);
+	else
+		ft_fprintf_fd(2, "minishell: printf: %s\n", msg);
+	p->status = 1;
+}
+
+void	printf_string(t_printf *p, t_fmt_spec *spec, const char *s, size_t len)
+{
+	int	pad;
+
+	pad = spec->width - (int) len;
+	if (!spec->left)
+		outbuf_fill(p->out, ' ', pad);
+	outbuf_put(p->out, s, len);
+	if (spec->left)
+		outbuf_fill(p->out, ' ', pad);
+}
+
+/*
+ * Literal text goes out in runs, up to the next escape or conversion
+ */
+static void	printf_pass(t_printf *p, const char *fmt)
+{
+	size_t	run;
+	char	c;
+
+	while (*fmt && !p->stop)
+	{
+		run = 0;
+		while (fmt[run] && fmt[run] != '\\' && fmt[run] != '%')
+			run++;
+		outbuf_put(p->out, fmt, run);
+		fmt += run;
+		if (*fmt == '\\')
+		{
+			fmt += printf_escape(fmt, &c, 0);
+			outbuf_put(p->out, &c, 1);
+		}
+		else if (fmt[0] == '%' && fmt[1] == '%')
+		{
+			outbuf_put(p->out, "%", 1);
+			fmt += 2;
+		}
+		else if (*fmt == '%')
+			fmt = printf_conversion(p, fmt + 1);
+	}
+}
+
+/*
+ * The format is used again while arguments remain, as long as it
+ * consumes some; the output is flushed once at the end
+ */
+int	builtin_printf(t_cmd_ctx *cmd_ctx)
+{
+	t_printf	p;
+	char		**args;
+	int			start;
+
+	args = cmd_ctx->current->args + 1;
+	if (args[0] && ft_strcmp(args[0], "--") == 0)
+		args++;
+	if (!args[0])
+		return (ft_putstr_fd("minishell: printf: usage: printf format "
+				"[arguments]\n", 2), 2);
+	ft_bzero(&p, sizeof(t_printf));
+	p.out = builtin_out();
+	p.args = args + 1;
+	while (p.args[p.count])
+		p.count++;
+	start = 0;
+	printf_pass(&p, args[0]);
+	while (!p.stop && p.next > start && p.next < p.count)
+	{
+		start = p.next;
+		printf_pass(&p, args[0]);
+	}
+	if (outbuf_flush(p.out) == -1)
+		printf_error(&p, "write error", strerror(p.out->failed));
+	return (p.status);
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_printf_big.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:46:27 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:46:27 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Multiplies the number held in limb[0..count) by 2^shift, with shift at
+ * most 29 so that a limb times it still fits in 64 bits. Returns the new
+ * number of limbs
+ */
+static int	big_shift(unsigned int *limb, int count, int shift)
+{
+	unsigned long long	carry;
+	unsigned long long	x;
+	int					i;
+
+	carry = 0;
+	i = -1;
+	while (++i < count)
+	{
+		x = ((unsigned long long) limb[i] << shift) + carry;
+		limb[i] = x % 1000000000;
+		carry = x / 1000000000;
+	}
+	while (carry > 0)
+	{
+		limb[count++] = carry % 1000000000;
+		carry /= 1000000000;
+	}
+	return (count);
+}
+
+static char	*big_text(unsigned int *limb, int count)
+{
+	char	*s;
+	int		len;
+
+	s = malloc((size_t) count * 9 + 1);
+	if (!s)
+		return (NULL);
+	len = printf_digits(s, limb[count - 1], "0123456789", 1);
+	while (--count > 0)
+		len += printf_digits(s + len, limb[count - 1], "0123456789", 9);
+	return (s);
+}
+
+/*
+ * Halves v until it fits in 64 bits, which is exact, and returns how
+ * many times it did
+ */
+static int	big_exponent(long double *v)
+{
+	int	e;
+
+	e = 0;
+	while (*v >= 18446744073709551616.0L)
+	{
+		*v /= 2;
+		e++;
+	}
+	return (e);
+}
+
+/*
+ * v (at least 2^64) is m * 2^e with a 64-bit m; m is doubled e times in
+ * base 10^9 so that every digit printed is the true one
+ */
+char	*printf_big_integer(long double v)
+{
+	unsigned int		limb[PRINTF_BIG_LIMBS];
+	unsigned long long	m;
+	int					e;
+	int					count;
+	int					shift;
+
+	e = big_exponent(&v);
+	m = (unsigned long long) v;
+	count = 0;
+	while (m > 0)
+	{
+		limb[count++] = m % 1000000000;
+		m /= 1000000000;
+	}
+	while (e > 0)
+	{
+		shift = e;
+		if (shift > 29)
+			shift = 29;
+		count = big_shift(limb, count, shift);
+		e -= shift;
+	}
+	return (big_text(limb, count));
+}
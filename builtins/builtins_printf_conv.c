@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_printf_conv.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:42:42 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 18:42:42 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static char	*sign_prefix(t_fmt_spec *spec, int negative)
+{
+	if (negative)
+		return ("-");
+	if (spec->plus)
+		return ("+");
+	if (spec->space)
+		return (" ");
+	return ("");
+}
+
+static const char	*digit_alphabet(char conv)
+{
+	if (conv == 'o')
+		return ("01234567");
+	if (conv == 'x')
+		return ("0123456789abcdef");
+	if (conv == 'X')
+		return ("0123456789ABCDEF");
+	return ("0123456789");
+}
+
+/*
+ * Zeros from the precision go between the prefix and the digits; the
+ * 0 flag fills the width the same way when there is no precision
+ */
+void	printf_number(t_printf *p, t_fmt_spec *spec, const char *prefix,
+		const char *digits)
+{
+	int	prefix_len;
+	int	digits_len;
+	int	zeros;
+	int	pad;
+
+	prefix_len = ft_strlen(prefix);
+	digits_len = ft_strlen(digits);
+	zeros = 0;
+	if (spec->precision > digits_len)
+		zeros = spec->precision - digits_len;
+	else if (spec->zero && !spec->left && spec->precision < 0)
+		zeros = spec->width - prefix_len - digits_len;
+	if (zeros < 0)
+		zeros = 0;
+	pad = spec->width - prefix_len - zeros - digits_len;
+	if (!spec->left)
+		outbuf_fill(p->out, ' ', pad);
+	outbuf_put(p->out, prefix, prefix_len);
+	outbuf_fill(p->out, '0', zeros);
+	outbuf_put(p->out, digits, digits_len);
+	if (spec->left)
+		outbuf_fill(p->out, ' ', pad);
+}
+
+void	printf_integer(t_printf *p, t_fmt_spec *spec)
+{
+	char				digits[72];
+	char				*prefix;
+	unsigned long long	v;
+
+	v = (unsigned long long) printf_int_arg(p, !ft_strchr("di", spec->conv));
+	prefix = "";
+	if (ft_strchr("di", spec->conv))
+		prefix = sign_prefix(spec, (long long) v < 0);
+	if (prefix[0] == '-')
+		v = 0 - v;
+	printf_digits(digits, v, digit_alphabet(spec->conv), spec->precision != 0);
+	if (spec->alt && spec->conv == 'o' && digits[0] != '0'
+		&& (int) ft_strlen(digits) >= spec->precision)
+		prefix = "0";
+	else if (spec->alt && v != 0 && spec->conv == 'x')
+		prefix = "0x";
+	else if (spec->alt && v != 0 && spec->conv == 'X')
+		prefix = "0X";
+	printf_number(p, spec, prefix, digits);
+}
+
+/*
+ * The precision of %f counts fraction digits, so the field itself is
+ * laid out without one
+ */
+void	printf_float(t_printf *p, t_fmt_spec *spec)
+{
+	long double	v;
+	char		*digits;
+	char		*prefix;
+	t_fmt_spec	field;
+
+	v = printf_float_arg(p);
+	prefix = sign_prefix(spec, v < 0 || (v == 0 && 1 / v < 0));
+	if (prefix[0] == '-')
+		v = -v;
+	if (spec->precision < 0)
+		spec->precision = 6;
+	digits = printf_fixed(v, spec->precision, spec->alt);
+	if (!digits)
+		return (printf_error(p, NULL, strerror(ENOMEM)));
+	field = *spec;
+	field.precision = -1;
+	printf_number(p, &field, prefix, digits);
+	free(digits);
+}
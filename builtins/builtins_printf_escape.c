@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_printf_escape.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:44:04 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 17:44:04 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	escape_number(const char *s, int base, int max, char *c)
+{
+	const char	*digits;
+	const char	*found;
+	int			len;
+	int			value;
+
+	digits = "0123456789abcdef";
+	len = 0;
+	value = 0;
+	while (len < max && s[len])
+	{
+		found = ft_strchr(digits, ft_tolower(s[len]));
+		if (!found || found - digits >= base)
+			break ;
+		value = value * base + (found - digits);
+		len++;
+	}
+	*c = (char) value;
+	return (len);
+}
+
+/*
+ * s is at a backslash; returns how much of s the escape takes and sets
+ * *c to the byte it stands for. Octal in the format is \NNN; in a %b
+ * argument it may also be \0NNN, and \", \' and \? keep their backslash.
+ * An unknown escape is a plain backslash and the next character is read
+ * on its own
+ */
+int	printf_escape(const char *s, char *c, int in_arg)
+{
+	const char	*letters;
+	const char	*found;
+
+	letters = "\\abefnrtv";
+	found = NULL;
+	if (s[1])
+		found = ft_strchr(letters, s[1]);
+	*c = '\\';
+	if (found)
+		*c = "\\\a\b\033\f\n\r\t\v"[found - letters];
+	else if (s[1] && !in_arg && ft_strchr("\"'?", s[1]))
+		*c = s[1];
+	else if (s[1] == 'x' && s[2]
+		&& ft_strchr("0123456789abcdef", ft_tolower(s[2])))
+		return (2 + escape_number(s + 2, 16, 2, c));
+	else if (in_arg && s[1] == '0')
+		return (2 + escape_number(s + 2, 8, 3, c));
+	else if (s[1] >= '0' && s[1] <= '7')
+		return (1 + escape_number(s + 1, 8, 3, c));
+	else
+		return (1);
+	return (2);
+}
+
+/*
+ * The argument with its escapes expanded; \c ends it and all further
+ * output. Escapes never lengthen the text, so its own size is enough
+ */
+void	printf_b(t_printf *p, t_fmt_spec *spec)
+{
+	char	*arg;
+	char	*text;
+	size_t	len;
+	size_t	i;
+
+	arg = printf_arg(p);
+	text = malloc(ft_strlen(arg) + 1);
+	if (!text)
+		return (printf_error(p, NULL, strerror(ENOMEM)));
+	len = 0;
+	i = 0;
+	while (arg[i] && !(arg[i] == '\\' && arg[i + 1] == 'c'))
+	{
+		if (arg[i] == '\\')
+			i += printf_escape(arg + i, text + len++, 1);
+		else
+			text[len++] = arg[i++];
+	}
+	p->stop = (arg[i] != '\0');
+	if (spec->precision >= 0 && (size_t) spec->precision < len)
+		len = spec->precision;
+	printf_string(p, spec, text, len);
+	free(text);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_printf_fixed.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:16:27 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 16:16:27 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+long double	printf_pow10(int e)
+{
+	long double	result;
+	long double	base;
+
+	result = 1.0L;
+	base = 10.0L;
+	while (e > 0)
+	{
+		if (e & 1)
+			result *= base;
+		base *= base;
+		e >>= 1;
+	}
+	return (result);
+}
+
+/*
+ * The rounding error of p = a * b, found exactly by splitting both
+ * factors in halves (Dekker), so that a product that rounded onto a
+ * half can still be told apart from a true half
+ */
+static long double	product_error(long double a, long double b, long double p)
+{
+	long double	split;
+	long double	a_hi;
+	long double	b_hi;
+
+	split = 4294967297.0L;
+	a_hi = a * split - (a * split - a);
+	b_hi = b * split - (b * split - b);
+	return (((a_hi * b_hi - p) + a_hi * (b - b_hi) + (a - a_hi) * b_hi)
+		+ (a - a_hi) * (b - b_hi));
+}
+
+/*
+ * v (below 2^64) rounded to `digits` (at most 18) fraction digits:
+ * part[0] is the integer part and part[1] the fraction times 10^digits.
+ * A value exactly halfway goes to the even neighbour, as in the C library
+ */
+static void	round_fixed(long double v, int digits, unsigned long long part[2])
+{
+	long double	scale;
+	long double	scaled;
+	long double	rest;
+	long double	error;
+	int			odd;
+
+	if (digits > 18)
+		digits = 18;
+	scale = printf_pow10(digits);
+	part[0] = (unsigned long long) v;
+	v -= (long double) part[0];
+	scaled = v * scale;
+	part[1] = (unsigned long long) scaled;
+	rest = scaled - (long double) part[1];
+	error = product_error(v, scale, scaled);
+	odd = part[1] & 1;
+	if (digits == 0)
+		odd = part[0] & 1;
+	if (rest > 0.5L || (rest == 0.5L && (error > 0 || (error == 0 && odd))))
+		part[1]++;
+	if ((long double) part[1] >= scale)
+	{
+		part[0]++;
+		part[1] = 0;
+	}
+}
+
+static char	*fixed_text(char *whole, unsigned long long fraction,
+		int precision, int alt)
+{
+	char	*s;
+	int		exact;
+	int		len;
+
+	exact = precision;
+	if (exact > 18)
+		exact = 18;
+	len = ft_strlen(whole);
+	s = malloc(len + (size_t) precision + 2);
+	if (!s)
+		return (NULL);
+	ft_memcpy(s, whole, len);
+	if (precision > 0 || alt)
+		s[len++] = '.';
+	if (exact > 0)
+		len += printf_digits(s + len, fraction, "0123456789", exact);
+	ft_memset(s + len, '0', precision - exact);
+	s[len + precision - exact] = '\0';
+	return (s);
+}
+
+/*
+ * v (not negative) in %f notation. From 2^64 up a long double has no
+ * fraction and its integer part is written out exactly; below that,
+ * fraction digits past the 18th come out as zeros
+ */
+char	*printf_fixed(long double v, int precision, int alt)
+{
+	unsigned long long	part[2];
+	char				*whole;
+	char				*s;
+
+	if (v != v)
+		return (ft_strdup("nan"));
+	if (v - v != 0)
+		return (ft_strdup("inf"));
+	part[1] = 0;
+	if (v >= 18446744073709551616.0L)
+		whole = printf_big_integer(v);
+	else
+	{
+		round_fixed(v, precision, part);
+		whole = malloc(24);
+		if (whole)
+			printf_digits(whole, part[0], "0123456789", 1);
+	}
+	if (!whole)
+		return (NULL);
+	s = fixed_text(whole, part[1], precision, alt);
+	free(whole);
+	return (s);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_printf_float.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:07:59 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:07:59 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static const char	*skip_sign(const char *s, t_fmt_num *n)
+{
+	while (*s == ' ' || *s == '\t' || *s == '\n')
+		s++;
+	n->negative = (*s == '-');
+	if (*s == '-' || *s == '+')
+		s++;
+	return (s);
+}
+
+/*
+ * Up to 18 significant digits are kept as an integer, so that exact
+ * inputs such as 2.25 stay exact; later digits before the point only
+ * raise the exponent and later ones after it are dropped
+ */
+static const char	*parse_mantissa(const char *s, t_fmt_num *n)
+{
+	int	seen_point;
+
+	seen_point = 0;
+	while (ft_isdigit(*s) || (*s == '.' && !seen_point))
+	{
+		if (*s == '.')
+			seen_point = 1;
+		else if (n->mag < 100000000000000000ULL)
+		{
+			n->mag = n->mag * 10 + (*s - '0');
+			n->exp10 -= seen_point;
+		}
+		else
+			n->exp10 += !seen_point;
+		s++;
+	}
+	return (s);
+}
+
+static const char	*parse_exponent(const char *s, t_fmt_num *n)
+{
+	int	skip;
+	int	e;
+
+	if (*s != 'e' && *s != 'E')
+		return (s);
+	skip = 1 + (s[1] == '-' || s[1] == '+');
+	if (!ft_isdigit(s[skip]))
+		return (s);
+	e = 0;
+	while (ft_isdigit(s[skip]))
+	{
+		if (e < 100000)
+			e = e * 10 + (s[skip] - '0');
+		skip++;
+	}
+	if (s[1] == '-')
+		e = -e;
+	n->exp10 += e;
+	return (s + skip);
+}
+
+/*
+ * Blanks, a sign, digits with an optional point, then an optional
+ * exponent; a quoted character gives its code, as for integers
+ */
+long double	printf_float_arg(t_printf *p)
+{
+	char		*arg;
+	const char	*s;
+	const char	*end;
+	t_fmt_num	n;
+	long double	v;
+
+	arg = printf_arg(p);
+	if (arg[0] == '\'' || arg[0] == '"')
+		return ((unsigned char) arg[1]);
+	ft_bzero(&n, sizeof(t_fmt_num));
+	s = skip_sign(arg, &n);
+	end = parse_mantissa(s, &n);
+	if (end == s || (end == s + 1 && *s == '.'))
+		end = arg;
+	else
+		end = parse_exponent(end, &n);
+	if (*end)
+		printf_error(p, arg, "invalid number");
+	if (n.exp10 < 0)
+		v = (long double) n.mag / printf_pow10(-n.exp10);
+	else
+		v = (long double) n.mag * printf_pow10(n.exp10);
+	if (n.negative)
+		return (-v);
+	return (v);
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_printf_int.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:53:17 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 13:53:17 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	digit_value(char c)
+{
+	if (ft_isdigit(c))
+		return (c - '0');
+	if (c >= 'a' && c <= 'f')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'F')
+		return (c - 'A' + 10);
+	return (99);
+}
+
+/*
+ * Reads like strtoimax with base 0: blanks, a sign, then hex after 0x,
+ * octal after 0 or decimal. Returns the end of the digits, or the start
+ * of the text when there are none
+ */
+static const char	*parse_int(const char *text, t_fmt_num *n)
+{
+	const char	*s;
+	const char	*digits;
+	int			base;
+
+	s = text;
+	while (*s == ' ' || *s == '\t' || *s == '\n')
+		s++;
+	n->negative = (*s == '-');
+	if (*s == '-' || *s == '+')
+		s++;
+	base = 10;
+	if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X') && digit_value(s[2]) < 16)
+		base = 16;
+	else if (s[0] == '0')
+		base = 8;
+	s += 2 * (base == 16);
+	digits = s;
+	while (digit_value(*s) < base)
+	{
+		n->overflow |= (n->mag > (ULLONG_MAX - digit_value(*s)) / base);
+		n->mag = n->mag * base + digit_value(*s++);
+	}
+	if (s == digits)
+		return (text);
+	return (s);
+}
+
+/*
+ * Sets *v to n as the conversion reads it, clamped when out of range;
+ * unsigned conversions wrap negative values around
+ */
+static int	int_value(t_fmt_num *n, int is_unsigned, long long *v)
+{
+	int	fits;
+
+	fits = !n->overflow;
+	if (fits && !is_unsigned && n->negative)
+		fits = (n->mag <= (unsigned long long) LLONG_MAX + 1);
+	else if (fits && !is_unsigned)
+		fits = (n->mag <= LLONG_MAX);
+	*v = (long long) n->mag;
+	if (n->negative)
+		*v = (long long)(0 - n->mag);
+	if (!fits && is_unsigned)
+		*v = (long long) ULLONG_MAX;
+	else if (!fits && n->negative)
+		*v = LLONG_MIN;
+	else if (!fits)
+		*v = LLONG_MAX;
+	return (fits);
+}
+
+/*
+ * A quote followed by a character gives that character's code. Out of
+ * range values are clamped with a warning, as bash does
+ */
+long long	printf_int_arg(t_printf *p, int is_unsigned)
+{
+	char		*arg;
+	const char	*end;
+	t_fmt_num	n;
+	long long	v;
+
+	arg = printf_arg(p);
+	if (arg[0] == '\'' || arg[0] == '"')
+		return ((unsigned char) arg[1]);
+	ft_bzero(&n, sizeof(t_fmt_num));
+	end = parse_int(arg, &n);
+	if (*end)
+		printf_error(p, arg, "invalid number");
+	if (!int_value(&n, is_unsigned, &v))
+		ft_fprintf_fd(2, "minishell: printf: warning: %s: %s\n", arg,
+			strerror(ERANGE));
+	return (v);
+}
+
+/*
+ * The digits of v in the base of the alphabet, at least min of them
+ */
+int	printf_digits(char *buf, unsigned long long v, const char *alphabet,
+		int min)
+{
+	char	tmp[64];
+	int		base;
+	int		len;
+	int		i;
+
+	base = ft_strlen(alphabet);
+	len = 0;
+	while (v > 0 || len < min)
+	{
+		tmp[len++] = alphabet[v % base];
+		v /= base;
+	}
+	i = -1;
+	while (++i < len)
+		buf[i] = tmp[len - 1 - i];
+	buf[len] = '\0';
+	return (len);
+}
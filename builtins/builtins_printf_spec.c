@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_printf_spec.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:05:50 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 10:05:50 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * A width or precision: digits, or `*` to take it from the arguments
+ */
+static int	spec_number(t_printf *p, const char **fmt)
+{
+	long long	value;
+
+	if (**fmt == '*')
+	{
+		(*fmt)++;
+		value = printf_int_arg(p, 0);
+		if (value > INT_MAX)
+			value = INT_MAX;
+		if (value < -INT_MAX)
+			value = -INT_MAX;
+		return ((int) value);
+	}
+	value = 0;
+	while (ft_isdigit(**fmt))
+	{
+		if (value < INT_MAX / 10)
+			value = value * 10 + (*(*fmt) - '0');
+		(*fmt)++;
+	}
+	return ((int) value);
+}
+
+/*
+ * Length modifiers are accepted and ignored: every integer is 64 bits
+ * and every float a long double
+ */
+static const char	*parse_spec(t_printf *p, const char *fmt, t_fmt_spec *spec)
+{
+	ft_bzero(spec, sizeof(t_fmt_spec));
+	while (*fmt && ft_strchr("-+ #0", *fmt))
+	{
+		spec->left |= (*fmt == '-');
+		spec->plus |= (*fmt == '+');
+		spec->space |= (*fmt == ' ');
+		spec->alt |= (*fmt == '#');
+		spec->zero |= (*fmt++ == '0');
+	}
+	spec->width = spec_number(p, &fmt);
+	spec->left |= (spec->width < 0);
+	if (spec->width < 0)
+		spec->width = -spec->width;
+	spec->precision = -1;
+	if (*fmt == '.')
+	{
+		fmt++;
+		spec->precision = spec_number(p, &fmt);
+	}
+	if (spec->precision < 0)
+		spec->precision = -1;
+	while (*fmt && ft_strchr("hlLjzt", *fmt))
+		fmt++;
+	spec->conv = *fmt;
+	return (fmt);
+}
+
+/*
+ * An unknown conversion ends the output, as the rest of the format can
+ * no longer be matched with the arguments
+ */
+static const char	*bad_conversion(t_printf *p, const char *fmt)
+{
+	char	word[5];
+
+	p->stop = 1;
+	if (!*fmt)
+	{
+		printf_error(p, "`%'", "missing format character");
+		return (fmt);
+	}
+	ft_memcpy(word, "`%?'", 5);
+	word[2] = *fmt;
+	printf_error(p, word, "invalid format character");
+	return (fmt + 1);
+}
+
+/*
+ * fmt is just past the `%`; returns where the format continues
+ */
+const char	*printf_conversion(t_printf *p, const char *fmt)
+{
+	t_fmt_spec	spec;
+	char		*arg;
+
+	fmt = parse_spec(p, fmt, &spec);
+	if (spec.conv == 's' || spec.conv == 'c')
+	{
+		arg = printf_arg(p);
+		if (spec.conv == 'c')
+			printf_string(p, &spec, arg, 1);
+		else if (spec.precision >= 0 && spec.precision < (int) ft_strlen(arg))
+			printf_string(p, &spec, arg, spec.precision);
+		else
+			printf_string(p, &spec, arg, ft_strlen(arg));
+	}
+	else if (spec.conv == 'b')
+		printf_b(p, &spec);
+	else if (spec.conv && ft_strchr("diuoxX", spec.conv))
+		printf_integer(p, &spec);
+	else if (spec.conv == 'f' || spec.conv == 'F')
+		printf_float(p, &spec);
+	else
+		return (bad_conversion(p, fmt));
+	return (fmt + 1);
+}
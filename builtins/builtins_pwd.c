@@ -12,7 +12,7 @@
 
 #include "../minishell.h"
 
-int	builtin_pwd(t_env **env)
+int	builtin_pwd(t_cmd_ctx *cmd_ctx)
 {
 	char	current_dir[PATH_MAX];
 	t_env	*pwd_node;
@@ -25,7 +25,7 @@ int	builtin_pwd(t_env **env)
 	}
 	else
 	{
-		pwd_node = find_env_node(*env, "PWD");
+		pwd_node = find_env_node(*cmd_ctx->env_list, "PWD");
 		if (pwd_node && pwd_node->value)
 		{
 			pwd_env = pwd_node->value;
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_registry.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:48:36 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:48:36 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Each builtin sits in the slot builtin_hash gives its name, so the
+ * slots are fixed when the table is compiled. Registering a builtin is
+ * one entry at (first * 3 + last + length) % 32; two names in one slot
+ * are a build error, as the second initializer would override the first
+ */
+static const t_builtin	*builtin_table(void)
+{
+	static const t_builtin	table[BUILTIN_SLOTS] = {
+	[0] = {"cat", run_builtin_cat,
+		BUILTIN_READS_STDIN | BUILTIN_NO_OPTIONS},
+	[2] = {"echo", builtin_echo, BUILTIN_NO_FORK | BUILTIN_OUTPUT_ONLY},
+	[4] = {"parallel", builtin_parallel,
+		BUILTIN_NO_FORK | BUILTIN_READS_STDIN},
+	[7] = {"exit", builtin_exit, BUILTIN_PARENT},
+	[8] = {"env", builtin_env, BUILTIN_NO_FORK | BUILTIN_OUTPUT_ONLY},
+	[9] = {"export", builtin_export, BUILTIN_PARENT},
+	[13] = {"[", builtin_test, BUILTIN_NO_FORK | BUILTIN_OUTPUT_ONLY},
+	[15] = {"cd", builtin_cd, BUILTIN_PARENT},
+	[20] = {"test", builtin_test, BUILTIN_NO_FORK | BUILTIN_OUTPUT_ONLY},
+	[22] = {"exec", builtin_exec, BUILTIN_PARENT},
+	[23] = {"pwd", builtin_pwd, BUILTIN_NO_FORK | BUILTIN_OUTPUT_ONLY},
+	[24] = {"unset", builtin_unset, BUILTIN_PARENT},
+	[25] = {"ulimit", builtin_ulimit, BUILTIN_PARENT},
+	[28] = {"printf", builtin_printf, BUILTIN_NO_FORK | BUILTIN_OUTPUT_ONLY},
+	};
+
+	return (table);
+}
+
+static int	builtin_hash(const char *name)
+{
+	size_t	len;
+
+	len = ft_strlen(name);
+	return (((unsigned char) name[0] * 3 + (unsigned char) name[len - 1]
+			+ len) % BUILTIN_SLOTS);
+}
+
+/*
+ * One hash and one comparison; the comparison turns away names that
+ * merely share a slot with a builtin
+ */
+const t_builtin	*builtin_lookup(const char *name)
+{
+	const t_builtin	*builtin;
+
+	if (!name || !name[0])
+		return (NULL);
+	builtin = &builtin_table()[builtin_hash(name)];
+	if (!builtin->name || ft_strcmp(builtin->name, name) != 0)
+		return (NULL);
+	return (builtin);
+}
+
+static int	has_option(t_command *cmd)
+{
+	int	i;
+
+	i = 0;
+	while (++i < cmd->args_count)
+	{
+		if (cmd->args[i][0] == '-' && cmd->args[i][1])
+			return (1);
+	}
+	return (0);
+}
+
+/*
+ * The builtin that runs cmd, if any: a BUILTIN_NO_OPTIONS builtin leaves
+ * a command with options to the external program of the same name
+ */
+const t_builtin	*command_builtin(t_command *cmd)
+{
+	const t_builtin	*builtin;
+
+	if (!cmd->args || !cmd->args[0])
+		return (NULL);
+	builtin = builtin_lookup(cmd->args[0]);
+	if (builtin && (builtin->flags & BUILTIN_NO_OPTIONS) && has_option(cmd))
+		return (NULL);
+	return (builtin);
+}
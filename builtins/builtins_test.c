@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_test.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:53:58 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:53:58 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+int	test_error(t_test *t, char *word, char *msg)
+{
+	if (!t->failed && word)
+		ft_fprintf_fd(2, "minishell: %s: %s: %s\n", t->name, word, msg);
+	else if (!t->failed)
+		ft_fprintf_fd(2, "minishell: %s: %s\n", t->name, msg);
+	t->failed = 1;
+	return (0);
+}
+
+/*
+ * Both sides are always parsed, so a syntax error on the right is
+ * reported even when the left already decides the result
+ */
+static int	test_and(t_test *t)
+{
+	int	result;
+	int	right;
+
+	result = test_term(t);
+	while (!t->failed && t->pos < t->end
+		&& ft_strcmp(t->argv[t->pos], "-a") == 0)
+	{
+		t->pos++;
+		right = test_term(t);
+		result = result && right;
+	}
+	return (result);
+}
+
+int	test_or(t_test *t)
+{
+	int	result;
+	int	right;
+
+	result = test_and(t);
+	while (!t->failed && t->pos < t->end
+		&& ft_strcmp(t->argv[t->pos], "-o") == 0)
+	{
+		t->pos++;
+		right = test_and(t);
+		result = result || right;
+	}
+	return (result);
+}
+
+/*
+ * `-a` binds tighter than `-o`, and `!` tighter than both. Returns 0 for
+ * true, 1 for false and 2 for a malformed expression
+ */
+int	builtin_test(t_cmd_ctx *cmd_ctx)
+{
+	t_test	t;
+	int		result;
+
+	t.name = cmd_ctx->current->args[0];
+	t.argv = cmd_ctx->current->args + 1;
+	t.end = cmd_ctx->current->args_count - 1;
+	t.pos = 0;
+	t.failed = 0;
+	if (ft_strcmp(t.name, "[") == 0)
+	{
+		if (t.end == 0 || ft_strcmp(t.argv[t.end - 1], "]") != 0)
+			return (test_error(&t, NULL, "missing `]'"), 2);
+		t.end--;
+	}
+	if (t.end == 0)
+		return (1);
+	result = test_or(&t);
+	if (!t.failed && t.pos < t.end)
+		test_error(&t, t.argv[t.pos], "unexpected argument");
+	if (t.failed)
+		return (2);
+	return (!result);
+}
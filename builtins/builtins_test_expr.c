@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_test_expr.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:06:10 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:06:10 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	is_binary_op(const char *word)
+{
+	static const char	*ops[] = {"=", "==", "!=", "<", ">", "-eq", "-ne",
+		"-lt", "-le", "-gt", "-ge", "-nt", "-ot", "-ef", NULL};
+	int					i;
+
+	i = 0;
+	while (ops[i] && ft_strcmp(ops[i], word) != 0)
+		i++;
+	return (ops[i] != NULL);
+}
+
+static int	is_unary_op(const char *word)
+{
+	return (word[0] == '-' && word[1] && !word[2]
+		&& ft_strchr("bcdefghkLnprsStuwxzOG", word[1]));
+}
+
+static int	test_paren(t_test *t)
+{
+	int	result;
+
+	t->pos++;
+	result = test_or(t);
+	if (t->failed)
+		return (0);
+	if (t->pos >= t->end || ft_strcmp(t->argv[t->pos], ")") != 0)
+		return (test_error(t, NULL, "`)' expected"));
+	t->pos++;
+	return (result);
+}
+
+/*
+ * A binary operator in second place wins, so `[ ! = x ]` and
+ * `[ -f = -f ]` compare strings. `!`, `(` and unary operators need a word
+ * after them; alone they are just non-empty strings
+ */
+int	test_term(t_test *t)
+{
+	char	*word;
+
+	if (t->pos >= t->end)
+		return (test_error(t, NULL, "argument expected"));
+	word = t->argv[t->pos];
+	if (t->pos + 2 < t->end && is_binary_op(t->argv[t->pos + 1]))
+	{
+		t->pos += 3;
+		return (test_binary(t, word, t->argv[t->pos - 2],
+				t->argv[t->pos - 1]));
+	}
+	if (t->pos + 1 < t->end && ft_strcmp(word, "!") == 0)
+	{
+		t->pos++;
+		return (!test_term(t));
+	}
+	if (t->pos + 1 < t->end && ft_strcmp(word, "(") == 0)
+		return (test_paren(t));
+	t->pos++;
+	if (t->pos < t->end && is_unary_op(word))
+		return (test_unary(word, t->argv[t->pos++]));
+	return (word[0] != '\0');
+}
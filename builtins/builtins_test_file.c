@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_test_file.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:39:12 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 19:39:12 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	file_type(char op, mode_t mode)
+{
+	if (op == 'f')
+		return (S_ISREG(mode));
+	if (op == 'd')
+		return (S_ISDIR(mode));
+	if (op == 'b')
+		return (S_ISBLK(mode));
+	if (op == 'c')
+		return (S_ISCHR(mode));
+	if (op == 'p')
+		return (S_ISFIFO(mode));
+	if (op == 'S')
+		return (S_ISSOCK(mode));
+	return (S_ISLNK(mode));
+}
+
+static int	file_attribute(char op, struct statx *stx)
+{
+	if (op == 's')
+		return (stx->stx_size > 0);
+	if (op == 'u')
+		return ((stx->stx_mode & S_ISUID) != 0);
+	if (op == 'g')
+		return ((stx->stx_mode & S_ISGID) != 0);
+	if (op == 'k')
+		return ((stx->stx_mode & S_ISVTX) != 0);
+	if (op == 'O')
+		return (stx->stx_uid == geteuid());
+	if (op == 'G')
+		return (stx->stx_gid == getegid());
+	return (1);
+}
+
+/*
+ * -r, -w and -x ask the kernel with the effective ids, which also
+ * covers root and ACLs; every other test is one statx, which only
+ * fetches the fields a test can look at
+ */
+int	test_file(char op, const char *path)
+{
+	struct statx	stx;
+	int				flags;
+	unsigned int	mask;
+
+	if (op == 'r')
+		return (faccessat(AT_FDCWD, path, R_OK, AT_EACCESS) == 0);
+	if (op == 'w')
+		return (faccessat(AT_FDCWD, path, W_OK, AT_EACCESS) == 0);
+	if (op == 'x')
+		return (faccessat(AT_FDCWD, path, X_OK, AT_EACCESS) == 0);
+	flags = AT_STATX_SYNC_AS_STAT;
+	if (op == 'h' || op == 'L')
+		flags |= AT_SYMLINK_NOFOLLOW;
+	mask = STATX_TYPE | STATX_MODE | STATX_UID | STATX_GID | STATX_SIZE;
+	if (statx(AT_FDCWD, path, flags, mask, &stx) == -1)
+		return (0);
+	if (ft_strchr("fdbcpShL", op))
+		return (file_type(op, stx.stx_mode));
+	return (file_attribute(op, &stx));
+}
+
+static int	stat_for_compare(const char *path, struct statx *stx)
+{
+	return (statx(AT_FDCWD, path, AT_STATX_SYNC_AS_STAT,
+			STATX_TYPE | STATX_INO | STATX_MTIME, stx) == 0);
+}
+
+/*
+ * -nt and -ot count a missing file as older than any existing one
+ */
+int	test_file_compare(char *left, char *op, char *right)
+{
+	struct statx	a;
+	struct statx	b;
+	int				has_a;
+	int				has_b;
+	int				cmp;
+
+	has_a = stat_for_compare(left, &a);
+	has_b = stat_for_compare(right, &b);
+	if (op[1] == 'e')
+		return (has_a && has_b && a.stx_dev_major == b.stx_dev_major
+			&& a.stx_dev_minor == b.stx_dev_minor && a.stx_ino == b.stx_ino);
+	if (!has_a || !has_b)
+		return ((op[1] == 'n' && has_a) || (op[1] == 'o' && has_b));
+	cmp = (a.stx_mtime.tv_sec > b.stx_mtime.tv_sec)
+		- (a.stx_mtime.tv_sec < b.stx_mtime.tv_sec);
+	if (cmp == 0)
+		cmp = (a.stx_mtime.tv_nsec > b.stx_mtime.tv_nsec)
+			- (a.stx_mtime.tv_nsec < b.stx_mtime.tv_nsec);
+	if (op[1] == 'n')
+		return (cmp > 0);
+	return (cmp < 0);
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_test_ops.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:02:25 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:02:25 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Optional blanks around an optional sign and at least one digit, as
+ * the external test accepts; anything else, or an overflow, is refused
+ */
+static int	parse_test_int(const char *s, long long *out)
+{
+	int	sign;
+	int	digits;
+
+	while (*s == ' ' || *s == '\t')
+		s++;
+	sign = 1;
+	if (*s == '-')
+		sign = -1;
+	if (*s == '-' || *s == '+')
+		s++;
+	*out = 0;
+	digits = 0;
+	while (ft_isdigit(*s))
+	{
+		if (*out > (LLONG_MAX - (*s - '0')) / 10)
+			return (-1);
+		*out = *out * 10 + (*s++ - '0');
+		digits++;
+	}
+	while (*s == ' ' || *s == '\t')
+		s++;
+	*out *= sign;
+	return (-(digits == 0 || *s != '\0'));
+}
+
+static int	test_integers(t_test *t, char *left, char *op, char *right)
+{
+	long long	a;
+	long long	b;
+
+	if (parse_test_int(left, &a) == -1)
+		return (test_error(t, left, "integer expression expected"));
+	if (parse_test_int(right, &b) == -1)
+		return (test_error(t, right, "integer expression expected"));
+	if (ft_strcmp(op, "-eq") == 0)
+		return (a == b);
+	if (ft_strcmp(op, "-ne") == 0)
+		return (a != b);
+	if (ft_strcmp(op, "-lt") == 0)
+		return (a < b);
+	if (ft_strcmp(op, "-le") == 0)
+		return (a <= b);
+	if (ft_strcmp(op, "-gt") == 0)
+		return (a > b);
+	return (a >= b);
+}
+
+int	test_binary(t_test *t, char *left, char *op, char *right)
+{
+	int	cmp;
+
+	if (ft_strcmp(op, "-nt") == 0 || ft_strcmp(op, "-ot") == 0
+		|| ft_strcmp(op, "-ef") == 0)
+		return (test_file_compare(left, op, right));
+	if (op[0] == '-')
+		return (test_integers(t, left, op, right));
+	cmp = ft_strcmp(left, right);
+	if (op[0] == '!')
+		return (cmp != 0);
+	if (op[0] == '<')
+		return (cmp < 0);
+	if (op[0] == '>')
+		return (cmp > 0);
+	return (cmp == 0);
+}
+
+/*
+ * Like bash, -t with something that is not a descriptor is just false
+ */
+int	test_unary(char *op, char *arg)
+{
+	long long	fd;
+
+	if (op[1] == 'n')
+		return (arg[0] != '\0');
+	if (op[1] == 'z')
+		return (arg[0] == '\0');
+	if (op[1] != 't')
+		return (test_file(op[1], arg));
+	return (parse_test_int(arg, &fd) == 0 && fd >= 0 && fd <= INT_MAX
+		&& isatty((int) fd));
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_ulimit.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:24:06 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 10:24:06 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	parse_flags(char *arg, t_ulimit *u)
+{
+	while (*++arg)
+	{
+		if (*arg == 'S')
+			u->which |= ULIMIT_SOFT;
+		else if (*arg == 'H')
+			u->which |= ULIMIT_HARD;
+		else if (*arg == 'a')
+			u->all = 1;
+		else if (ft_strchr(ULIMIT_OPTS, *arg) && u->count < ULIMIT_MAX)
+			u->opts[u->count++] = *arg;
+		else
+		{
+			ft_putstr_fd("minishell: ulimit: -", 2);
+			ft_putchar_fd(*arg, 2);
+			ft_putstr_fd(": invalid option\n", 2);
+			return (-1);
+		}
+	}
+	return (0);
+}
+
+static int	parse_value(char *word, t_limit_info *info, struct rlimit *rl,
+		rlim_t *out)
+{
+	int	i;
+
+	if (ft_strcmp(word, "unlimited") == 0)
+		*out = RLIM_INFINITY;
+	else if (ft_strcmp(word, "soft") == 0)
+		*out = rl->rlim_cur;
+	else if (ft_strcmp(word, "hard") == 0)
+		*out = rl->rlim_max;
+	else
+	{
+		*out = 0;
+		i = -1;
+		while (ft_isdigit(word[++i]) && *out < RLIM_INFINITY / 10 / info->scale)
+			*out = *out * 10 + (word[i] - '0');
+		if (i == 0 || word[i])
+			return (ft_fprintf_fd(2, "minishell: ulimit: %s: invalid number\n",
+					word), -1);
+		*out *= info->scale;
+	}
+	return (0);
+}
+
+/*
+ * Without -S or -H both limits are set, as in bash. A zygote started
+ * with the old limits would not apply the new ones, so it is retired
+ */
+static int	set_limit(t_limit_info *info, char *word, int which)
+{
+	struct rlimit	rl;
+	rlim_t			value;
+
+	if (getrlimit(info->resource, &rl) == -1
+		|| parse_value(word, info, &rl, &value) == -1)
+		return (1);
+	if (which == 0 || (which & ULIMIT_SOFT))
+		rl.rlim_cur = value;
+	if (which == 0 || (which & ULIMIT_HARD))
+		rl.rlim_max = value;
+	if (setrlimit(info->resource, &rl) == -1)
+	{
+		ft_fprintf_fd(2, "minishell: ulimit: %s: cannot modify limit: %s\n",
+			info->name, strerror(errno));
+		return (1);
+	}
+	zygote_stop();
+	return (0);
+}
+
+static int	run_limits(t_ulimit *u, char *value)
+{
+	t_limit_info	info;
+	int				status;
+	int				i;
+
+	status = 0;
+	i = -1;
+	while (++i < u->count)
+	{
+		limit_info(u->opts[i], &info);
+		if (value)
+			status |= set_limit(&info, value, u->which);
+		else
+			status |= print_limit(&info, u->which == ULIMIT_HARD,
+					u->count > 1);
+	}
+	return (status);
+}
+
+/*
+ * Run in the shell, the limits hold for every later child. Followed by
+ * a command, `ulimit -n 64 cmd` is forked and only cmd runs under them
+ */
+int	builtin_ulimit(t_cmd_ctx *cmd_ctx)
+{
+	t_command	*cmd;
+	t_ulimit	u;
+	int			end;
+	int			i;
+
+	cmd = cmd_ctx->current;
+	ft_bzero(&u, sizeof(u));
+	end = ulimit_command_index(cmd);
+	if (end == 0)
+		end = cmd->args_count;
+	i = 1;
+	while (i < end && cmd->args[i][0] == '-' && cmd->args[i][1])
+		if (parse_flags(cmd->args[i++], &u) == -1)
+			return (2);
+	if (u.all)
+		u.count = ft_strlcpy(u.opts, ULIMIT_OPTS, sizeof(u.opts));
+	if (u.count == 0)
+		u.opts[u.count++] = 'f';
+	if (i < end && run_limits(&u, cmd->args[i]))
+		return (1);
+	if (i >= end && run_limits(&u, NULL))
+		return (1);
+	if (end < cmd->args_count)
+		return (ulimit_run_command(cmd_ctx, end));
+	return (0);
+}
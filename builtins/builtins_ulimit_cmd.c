@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_ulimit_cmd.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:36:30 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 14:36:30 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Index of the command following `ulimit OPTIONS VALUE`, or 0 when there
+ * is none. The words are counted, not parsed, so this also works on a
+ * stage that is not expanded yet
+ */
+int	ulimit_command_index(t_command *cmd)
+{
+	int	i;
+
+	i = 1;
+	while (i < cmd->args_count && cmd->args[i][0] == '-' && cmd->args[i][1])
+		i++;
+	if (i < cmd->args_count)
+		i++;
+	if (i < cmd->args_count)
+		return (i);
+	return (0);
+}
+
+/*
+ * Only ever reached in a forked stage, which the limits now apply to
+ */
+int	ulimit_run_command(t_cmd_ctx *cmd_ctx, int index)
+{
+	t_command	*cmd;
+
+	cmd = cmd_ctx->current;
+	while (index-- > 0)
+		drop_first_word(cmd);
+	if (command_builtin(cmd))
+		exit(execute_builtin(cmd_ctx));
+	handle_external_command(cmd_ctx);
+	return (127);
+}
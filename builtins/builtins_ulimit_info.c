@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_ulimit_info.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:27:00 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:27:00 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static void	set_info(t_limit_info *info, int resource, char *name, char *unit)
+{
+	info->resource = resource;
+	info->name = name;
+	info->unit_name = unit;
+	info->scale = 1024;
+	if (!unit)
+		info->scale = 1;
+}
+
+/*
+ * Block and kbyte sizes are in units of 1024 bytes, as in bash
+ */
+int	limit_info(char opt, t_limit_info *info)
+{
+	info->opt = opt;
+	if (opt == 'c')
+		set_info(info, RLIMIT_CORE, "core file size", "blocks");
+	else if (opt == 'f')
+		set_info(info, RLIMIT_FSIZE, "file size", "blocks");
+	else if (opt == 'm')
+		set_info(info, RLIMIT_RSS, "max memory size", "kbytes");
+	else if (opt == 'n')
+		set_info(info, RLIMIT_NOFILE, "open files", NULL);
+	else if (opt == 's')
+		set_info(info, RLIMIT_STACK, "stack size", "kbytes");
+	else if (opt == 't')
+		set_info(info, RLIMIT_CPU, "cpu time", "seconds");
+	else if (opt == 'u')
+		set_info(info, RLIMIT_NPROC, "max user processes", NULL);
+	else if (opt == 'v')
+		set_info(info, RLIMIT_AS, "virtual memory", "kbytes");
+	else
+		return (-1);
+	if (opt == 't')
+		info->scale = 1;
+	return (0);
+}
+
+static void	put_limit_value(rlim_t value, rlim_t scale)
+{
+	char	buf[24];
+	int		i;
+
+	if (value == RLIM_INFINITY)
+		return (ft_putendl_fd("unlimited", STDOUT_FILENO));
+	value /= scale;
+	i = 23;
+	buf[i] = '\0';
+	buf[--i] = '0' + value % 10;
+	while (value >= 10)
+	{
+		value /= 10;
+		buf[--i] = '0' + value % 10;
+	}
+	ft_putendl_fd(buf + i, STDOUT_FILENO);
+}
+
+/*
+ * The name, then the unit and option ending at column 40, as in the
+ * lines of `ulimit -a`
+ */
+static void	print_label(t_limit_info *info)
+{
+	int	pad;
+
+	ft_putstr_fd(info->name, STDOUT_FILENO);
+	pad = 40 - ft_strlen(info->name) - 4;
+	if (info->unit_name)
+		pad -= ft_strlen(info->unit_name) + 2;
+	while (pad-- > 0)
+		ft_putchar_fd(' ', STDOUT_FILENO);
+	ft_putchar_fd('(', STDOUT_FILENO);
+	if (info->unit_name)
+		ft_fprintf_fd(STDOUT_FILENO, "%s, ", info->unit_name);
+	ft_putchar_fd('-', STDOUT_FILENO);
+	ft_putchar_fd(info->opt, STDOUT_FILENO);
+	ft_putstr_fd(") ", STDOUT_FILENO);
+}
+
+int	print_limit(t_limit_info *info, int hard, int labelled)
+{
+	struct rlimit	rl;
+
+	if (getrlimit(info->resource, &rl) == -1)
+	{
+		ft_fprintf_fd(2, "minishell: ulimit: %s: %s\n", info->name,
+			strerror(errno));
+		return (1);
+	}
+	if (labelled)
+		print_label(info);
+	if (hard)
+		put_limit_value(rl.rlim_max, info->scale);
+	else
+		put_limit_value(rl.rlim_cur, info->scale);
+	return (0);
+}
@@ -54,14 +54,14 @@ void	unset_one_arg(char *arg, t_env **env_list)
 	}
 }
 
-int	builtin_unset(t_command *cmd, t_env **env_list)
+int	builtin_unset(t_cmd_ctx *cmd_ctx)
 {
 	int	i;
 
 	i = 1;
-	while (i < cmd->args_count)
+	while (i < cmd_ctx->current->args_count)
 	{
-		unset_one_arg(cmd->args[i], env_list);
+		unset_one_arg(cmd_ctx->current->args[i], cmd_ctx->env_list);
 		i++;
 	}
 	return (0);
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   client.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:12:04 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 12:12:04 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	client_connect(const char *path)
+{
+	struct sockaddr_un	addr;
+	int					sock;
+
+	ft_bzero(&addr, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (ft_strlen(path) >= sizeof(addr.sun_path))
+		return (errno = ENAMETOOLONG, -1);
+	ft_memcpy(addr.sun_path, path, ft_strlen(path));
+	sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (sock < 0)
+		return (-1);
+	if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+		return (close(sock), -1);
+	return (sock);
+}
+
+/*
+ * Runs one command line with this process's stdin, stdout and stderr
+ * and returns its status, or -1 once the session is gone
+ */
+static int	client_request(int sock, char *line)
+{
+	t_server_req	req;
+	struct iovec	iov;
+	int				fds[SERVER_FDS];
+	int				status;
+
+	req.len = ft_strlen(line);
+	iov.iov_base = &req;
+	iov.iov_len = sizeof(req);
+	fds[0] = STDIN_FILENO;
+	fds[1] = STDOUT_FILENO;
+	fds[2] = STDERR_FILENO;
+	if (fd_send(sock, &iov, fds, SERVER_FDS) == -1
+		|| send_all(sock, line, req.len) == -1
+		|| read_all(sock, (char *)&status, sizeof(status)) == -1)
+		return (-1);
+	return (status);
+}
+
+/*
+ * `minishell_client PATH COMMAND...` sends each COMMAND to the server
+ * listening at PATH, over one connection, so `cd` and `export` carry
+ * over to the next one. Exits with the status of the last command run;
+ * an `exit` ends the session like it ends a script
+ */
+int	main(int argc, char **argv)
+{
+	int	sock;
+	int	status;
+	int	ret;
+	int	i;
+
+	if (argc < 3)
+		return (ft_putstr_fd("usage: minishell_client PATH COMMAND...\n", 2),
+			2);
+	sock = client_connect(argv[1]);
+	if (sock < 0)
+		return (ft_putstr_fd("minishell_client: ", 2), perror(argv[1]), 1);
+	status = 0;
+	i = 1;
+	while (++i < argc)
+	{
+		ret = client_request(sock, argv[i]);
+		if (ret < 0 && i == 2)
+			return (ft_putstr_fd("minishell_client: no answer\n", 2), 1);
+		if (ret < 0)
+			break ;
+		status = ret;
+	}
+	close(sock);
+	return (status);
+}
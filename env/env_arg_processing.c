@@ -19,7 +19,7 @@ static void	expand_and_strip_arg(t_command *cmd, char **envp, int i)
 
 	if (!cmd->args[i])
 		return ;
-	expanded = expand_variables(cmd->args[i], envp);
+	expanded = expand_variables_marked(cmd->args[i], envp, 1);
 	safe_free((void **)&cmd->args[i]);
 	if (!expanded)
 	{
@@ -76,6 +76,18 @@ static void	free_split_words(char **split_words)
 	safe_free((void **)&split_words);
 }
 
+/*
+ * A single resulting word replaces its slot directly, keeping argv
+ * expansion linear in the number of arguments.
+ */
+static int	replace_arg_in_place(t_command *cmd, int pos, char **split_words)
+{
+	safe_free((void **)&cmd->args[pos]);
+	cmd->args[pos] = split_words[0];
+	safe_free((void **)&split_words);
+	return (1);
+}
+
 int	split_and_insert_args(t_expand_vars *v)
 {
 	char	**split_words;
@@ -83,13 +95,16 @@ int	split_and_insert_args(t_expand_vars *v)
 
 	if ((v->i > 0 && !v->is_export) || (v->i == 0 && v->cmd->args_count == 1))
 	{
+		fold_field_separators(v->cmd->args[v->i]);
 		split_words = ft_split(v->cmd->args[v->i], ' ');
 		if (!split_words || !split_words[0])
 		{
 			free_split_words(split_words);
 			return (0);
 		}
-		if (count_split_words(split_words) > 1 || v->i > 0)
+		if (count_split_words(split_words) == 1 && v->i > 0)
+			return (replace_arg_in_place(v->cmd, v->i, split_words));
+		if (count_split_words(split_words) > 1)
 		{
 			added = add_split_args_to_command(v->cmd, v->i, split_words);
 			if (added > 0)
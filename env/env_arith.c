@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:00 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:00 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Blank text and plain decimal numbers (the usual content of a counter
+ * variable) are answered without compiling anything
+ */
+static int	parse_trivial(const char *s, long long *out)
+{
+	unsigned long long	v;
+	int					i;
+
+	i = 0;
+	while (ft_isspace(s[i]))
+		i++;
+	if (!s[i])
+		return (1);
+	if (s[i] == '-' || s[i] == '+')
+		i++;
+	if (!ft_isdigit(s[i]) || (s[i] == '0' && s[i + 1]))
+		return (0);
+	v = 0;
+	while (ft_isdigit(s[i]))
+		v = v * 10 + (s[i++] - '0');
+	if (s[i])
+		return (0);
+	if (ft_strchr(s, '-'))
+		v = 0 - v;
+	*out = (long long)v;
+	return (1);
+}
+
+/*
+ * Evaluates `text` with 64-bit integers and stores the value in `out`.
+ * Variables holding expressions are evaluated in turn, up to
+ * ARITH_MAX_DEPTH levels. Returns NULL or a message describing the error.
+ */
+const char	*arith_evaluate(const char *text, char **envp, int depth,
+		long long *out)
+{
+	t_arith_ctx	c;
+
+	*out = 0;
+	if (depth > ARITH_MAX_DEPTH)
+		return ("expression recursion level exceeded");
+	if (parse_trivial(text, out))
+		return (NULL);
+	ft_bzero(&c, sizeof(t_arith_ctx));
+	c.envp = envp;
+	c.depth = depth;
+	if (depth == 0)
+		c.expr = arith_cache_lookup(text);
+	else
+		c.expr = arith_compile(text);
+	if (!c.expr)
+		return ("syntax error in expression");
+	*out = arith_eval_node(&c, c.expr->root);
+	if (depth > 0)
+		arith_expr_free(c.expr);
+	return (c.error);
+}
+
+static int	append_number(char **result, long long value)
+{
+	char				buf[24];
+	unsigned long long	u;
+	int					i;
+	char				*tmp;
+
+	u = (unsigned long long)value;
+	if (value < 0)
+		u = 0 - u;
+	i = 23;
+	buf[i] = '\0';
+	buf[--i] = '0' + u % 10;
+	while (u >= 10)
+	{
+		u /= 10;
+		buf[--i] = '0' + u % 10;
+	}
+	if (value < 0)
+		buf[--i] = '-';
+	tmp = *result;
+	*result = ft_strjoin(tmp, buf + i);
+	safe_free((void **)&tmp);
+	return (*result != NULL);
+}
+
+/*
+ * The expression is the text between `$((` and `))`, unless those two
+ * parentheses do not pair up, as in `$((a)+(b))`
+ */
+static char	*arith_text(char *str, int open, int end, char **envp)
+{
+	char	*text;
+	char	*expanded;
+
+	if (subst_end(str, open) == end - 1)
+		text = ft_substr(str, open + 2, end - open - 4);
+	else
+		text = ft_substr(str, open + 1, end - open - 2);
+	if (!text || !ft_strchr(text, '$'))
+		return (text);
+	expanded = expand_variables(text, envp);
+	safe_free((void **)&text);
+	if (!expanded)
+		return (ft_strdup(""));
+	return (expanded);
+}
+
+/*
+ * str[var_exp->i] is the `(` following a `$`. `$((expr))` is replaced by
+ * the decimal value of expr; on error the expansion fails.
+ */
+int	expand_arith(t_var_expand *var_exp, char *str, char **envp)
+{
+	int			end;
+	char		*text;
+	long long	value;
+	const char	*error;
+
+	end = subst_end(str, var_exp->i - 1);
+	if (end < 0 || str[var_exp->i + 1] != '(' || str[end - 2] != ')')
+		return (add_char_to_result(&var_exp->result, '$'));
+	text = arith_text(str, var_exp->i, end, envp);
+	var_exp->i = end;
+	if (!text)
+		return (0);
+	error = arith_evaluate(text, envp, 0, &value);
+	if (error)
+	{
+		ft_putstr_fd("minishell: ", 2);
+		ft_putstr_fd(text, 2);
+		ft_putstr_fd(": ", 2);
+		ft_putendl_fd((char *)error, 2);
+		*expansion_error() = 1;
+		value = 0;
+	}
+	safe_free((void **)&text);
+	return (append_number(&var_exp->result, value));
+}
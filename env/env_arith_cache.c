@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith_cache.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:37:51 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:37:51 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static t_arith_expr	**arith_slots(void)
+{
+	static t_arith_expr	*slots[ARITH_CACHE_SLOTS];
+
+	return (slots);
+}
+
+static unsigned int	arith_hash(const char *text)
+{
+	unsigned int	hash;
+
+	hash = 2166136261u;
+	while (*text)
+		hash = (hash ^ (unsigned char)*text++) * 16777619u;
+	return (hash % ARITH_CACHE_SLOTS);
+}
+
+/*
+ * Returns the compiled form of `text`, compiling it on a miss. Slots are
+ * direct-mapped: a colliding expression simply evicts the old one.
+ */
+t_arith_expr	*arith_cache_lookup(const char *text)
+{
+	t_arith_expr	**slot;
+	t_arith_expr	*expr;
+
+	slot = &arith_slots()[arith_hash(text)];
+	if (*slot && ft_strcmp((*slot)->text, text) == 0)
+		return (*slot);
+	expr = arith_compile(text);
+	if (!expr)
+		return (NULL);
+	arith_expr_free(*slot);
+	*slot = expr;
+	return (expr);
+}
+
+void	arith_cache_clear(void)
+{
+	t_arith_expr	**slots;
+	int				i;
+
+	slots = arith_slots();
+	i = 0;
+	while (i < ARITH_CACHE_SLOTS)
+	{
+		arith_expr_free(slots[i]);
+		slots[i++] = NULL;
+	}
+}
+
+long long	arith_pow(t_arith_ctx *c, long long base, long long exponent)
+{
+	unsigned long long	result;
+	unsigned long long	square;
+
+	if (exponent < 0)
+	{
+		c->error = "exponent less than 0";
+		return (0);
+	}
+	result = 1;
+	square = (unsigned long long)base;
+	while (exponent)
+	{
+		if (exponent & 1)
+			result *= square;
+		square *= square;
+		exponent >>= 1;
+	}
+	return ((long long)result);
+}
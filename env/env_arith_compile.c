@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith_compile.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:56:07 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 18:56:07 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	parse_binary(t_arith_parser *p, int min_level)
+{
+	int			lhs;
+	int			rhs;
+	int			level;
+	t_arith_op	op;
+
+	lhs = arith_parse_power(p);
+	level = arith_binary_level(p->toks[p->pos].op);
+	while (!p->error && level >= min_level && level > 0)
+	{
+		op = p->toks[p->pos++].op;
+		rhs = parse_binary(p, level + 1);
+		if (p->error)
+			return (-1);
+		lhs = arith_node(p, op, lhs, rhs);
+		level = arith_binary_level(p->toks[p->pos].op);
+	}
+	return (lhs);
+}
+
+int	arith_parse_expr(t_arith_parser *p)
+{
+	int	cond;
+	int	yes;
+	int	no;
+	int	idx;
+
+	cond = parse_binary(p, 1);
+	if (p->error || p->toks[p->pos].op != ARITH_QUEST)
+		return (cond);
+	p->pos++;
+	yes = arith_parse_expr(p);
+	if (p->error || p->toks[p->pos].op != ARITH_COLON)
+	{
+		p->error = 1;
+		return (-1);
+	}
+	p->pos++;
+	no = arith_parse_expr(p);
+	if (p->error)
+		return (-1);
+	idx = arith_node(p, ARITH_TERNARY, yes, no);
+	p->expr->nodes[idx].cond = cond;
+	return (idx);
+}
+
+void	arith_toks_free(t_arith_tok *toks)
+{
+	int	i;
+
+	i = 0;
+	while (toks && toks[i].op != ARITH_END)
+		safe_free((void **)&toks[i++].name);
+	safe_free((void **)&toks);
+}
+
+void	arith_expr_free(t_arith_expr *expr)
+{
+	int	i;
+
+	if (!expr)
+		return ;
+	i = 0;
+	while (i < expr->count)
+		safe_free((void **)&expr->nodes[i++].name);
+	safe_free((void **)&expr->nodes);
+	safe_free((void **)&expr->text);
+	safe_free((void **)&expr);
+}
+
+/*
+ * Compiles the expression into a flat tree; nodes refer to their
+ * operands by index so the whole expression is one allocation.
+ */
+t_arith_expr	*arith_compile(const char *text)
+{
+	t_arith_parser	p;
+	int				ntoks;
+
+	ft_bzero(&p, sizeof(t_arith_parser));
+	ntoks = arith_lex(text, &p.toks);
+	if (ntoks <= 0)
+		return (arith_toks_free(p.toks), NULL);
+	p.expr = ft_calloc(1, sizeof(t_arith_expr));
+	if (p.expr)
+		p.expr->nodes = ft_calloc(ntoks + 1, sizeof(t_arith_node));
+	if (p.expr)
+		p.expr->text = ft_strdup(text);
+	if (!p.expr || !p.expr->nodes || !p.expr->text)
+		return (arith_toks_free(p.toks), arith_expr_free(p.expr), NULL);
+	p.expr->root = arith_parse_expr(&p);
+	if (p.toks[p.pos].op != ARITH_END)
+		p.error = 1;
+	arith_toks_free(p.toks);
+	if (p.error)
+		return (arith_expr_free(p.expr), NULL);
+	return (p.expr);
+}
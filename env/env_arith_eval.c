@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith_eval.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:24:56 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 10:24:56 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static long long	eval_var(t_arith_ctx *c, char *name)
+{
+	char		*value;
+	long long	result;
+	const char	*error;
+
+	value = get_env_value(name, c->envp);
+	result = 0;
+	if (value && *value)
+	{
+		error = arith_evaluate(value, c->envp, c->depth + 1, &result);
+		if (error)
+			c->error = error;
+	}
+	safe_free((void **)&value);
+	return (result);
+}
+
+static long long	eval_unary(t_arith_op op, long long v)
+{
+	if (op == ARITH_NEG)
+		return ((long long)(0ULL - (unsigned long long)v));
+	if (op == ARITH_NOT)
+		return (!v);
+	if (op == ARITH_BNOT)
+		return (~v);
+	return (v);
+}
+
+static long long	eval_compare(t_arith_op op, long long a, long long b)
+{
+	if (op == ARITH_SHL)
+		return ((long long)((unsigned long long)a << (b & 63)));
+	if (op == ARITH_SHR)
+		return (a >> (b & 63));
+	if (op == ARITH_LT)
+		return (a < b);
+	if (op == ARITH_GT)
+		return (a > b);
+	if (op == ARITH_LE)
+		return (a <= b);
+	if (op == ARITH_GE)
+		return (a >= b);
+	if (op == ARITH_EQ)
+		return (a == b);
+	if (op == ARITH_NE)
+		return (a != b);
+	if (op == ARITH_BAND)
+		return (a & b);
+	if (op == ARITH_BOR)
+		return (a | b);
+	return (a ^ b);
+}
+
+/*
+ * + - * wrap around like two's complement instead of overflowing
+ */
+static long long	eval_binary(t_arith_ctx *c, t_arith_op op, long long a,
+		long long b)
+{
+	if (op == ARITH_ADD)
+		return ((long long)((unsigned long long)a + (unsigned long long)b));
+	if (op == ARITH_SUB)
+		return ((long long)((unsigned long long)a - (unsigned long long)b));
+	if (op == ARITH_MUL)
+		return ((long long)((unsigned long long)a * (unsigned long long)b));
+	if ((op == ARITH_DIV || op == ARITH_MOD) && b == 0)
+	{
+		c->error = "division by 0";
+		return (0);
+	}
+	if (op == ARITH_DIV && b == -1)
+		return ((long long)(0ULL - (unsigned long long)a));
+	if (op == ARITH_MOD && b == -1)
+		return (0);
+	if (op == ARITH_DIV)
+		return (a / b);
+	if (op == ARITH_MOD)
+		return (a % b);
+	if (op == ARITH_POW)
+		return (arith_pow(c, a, b));
+	return (eval_compare(op, a, b));
+}
+
+long long	arith_eval_node(t_arith_ctx *c, int idx)
+{
+	t_arith_node	*node;
+	long long		lhs;
+
+	node = &c->expr->nodes[idx];
+	if (c->error)
+		return (0);
+	if (node->op == ARITH_NUM)
+		return (node->value);
+	if (node->op == ARITH_VAR)
+		return (eval_var(c, node->name));
+	if (node->rhs < 0)
+		return (eval_unary(node->op, arith_eval_node(c, node->lhs)));
+	if (node->op == ARITH_TERNARY && arith_eval_node(c, node->cond))
+		return (arith_eval_node(c, node->lhs));
+	if (node->op == ARITH_TERNARY)
+		return (arith_eval_node(c, node->rhs));
+	lhs = arith_eval_node(c, node->lhs);
+	if ((node->op == ARITH_LAND && !lhs) || (node->op == ARITH_LOR && lhs))
+		return (node->op == ARITH_LOR);
+	if (node->op == ARITH_LAND || node->op == ARITH_LOR)
+		return (arith_eval_node(c, node->rhs) != 0);
+	return (eval_binary(c, node->op, lhs, arith_eval_node(c, node->rhs)));
+}
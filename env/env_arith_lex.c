@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith_lex.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:58:30 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 20:58:30 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	lex_number(const char *s, t_arith_tok *tok)
+{
+	const char	*digits;
+	char		*at;
+	int			i;
+	int			base;
+
+	digits = "0123456789abcdef";
+	i = 0;
+	base = 10;
+	if (s[0] == '0')
+		base = 8;
+	if (s[0] == '0' && ft_tolower(s[1]) == 'x')
+	{
+		base = 16;
+		i = 2;
+	}
+	tok->op = ARITH_NUM;
+	while (ft_isalnum(s[i]))
+	{
+		at = ft_strchr(digits, ft_tolower(s[i++]));
+		if (!at || at - digits >= base)
+			return (-1);
+		tok->value = (long long)((unsigned long long)tok->value * base
+				+ (at - digits));
+	}
+	return (i);
+}
+
+static int	lex_name(const char *s, t_arith_tok *tok)
+{
+	int	i;
+
+	i = 0;
+	while (ft_isalnum(s[i]) || s[i] == '_')
+		i++;
+	tok->op = ARITH_VAR;
+	tok->name = ft_strndup(s, i);
+	if (!tok->name)
+		return (-1);
+	return (i);
+}
+
+static int	lex_operator(const char *s, t_arith_tok *tok)
+{
+	const char	*pairs;
+	const char	*singles;
+	int			k;
+
+	pairs = ARITH_PAIR_OPS;
+	k = 0;
+	while (pairs[k * 2] && (s[0] != pairs[k * 2] || s[1] != pairs[k * 2 + 1]))
+		k++;
+	if (pairs[k * 2])
+	{
+		tok->op = ARITH_POW + k;
+		return (2);
+	}
+	singles = ARITH_SINGLE_OPS;
+	k = 0;
+	while (singles[k] && singles[k] != s[0])
+		k++;
+	if (!singles[k])
+		return (-1);
+	tok->op = ARITH_ADD + k;
+	return (1);
+}
+
+static int	lex_one(const char *s, t_arith_tok *tok)
+{
+	ft_bzero(tok, sizeof(t_arith_tok));
+	if (ft_isdigit(*s))
+		return (lex_number(s, tok));
+	if (ft_isalpha(*s) || *s == '_')
+		return (lex_name(s, tok));
+	return (lex_operator(s, tok));
+}
+
+/*
+ * Splits the expression into tokens; the array always ends with
+ * ARITH_END. Returns the token count or -1 on an invalid character.
+ */
+int	arith_lex(const char *s, t_arith_tok **toks)
+{
+	int	n;
+	int	i;
+	int	len;
+
+	*toks = ft_calloc(ft_strlen(s) + 1, sizeof(t_arith_tok));
+	if (!*toks)
+		return (-1);
+	n = 0;
+	i = 0;
+	while (s[i])
+	{
+		len = 1;
+		if (!ft_isspace(s[i]))
+			len = lex_one(s + i, &(*toks)[n++]);
+		if (len <= 0)
+		{
+			(*toks)[n].op = ARITH_END;
+			arith_toks_free(*toks);
+			*toks = NULL;
+			return (-1);
+		}
+		i += len;
+	}
+	(*toks)[n].op = ARITH_END;
+	return (n);
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith_parse.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:10:48 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:10:48 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+int	arith_node(t_arith_parser *p, t_arith_op op, int lhs, int rhs)
+{
+	t_arith_node	*node;
+
+	node = &p->expr->nodes[p->expr->count];
+	ft_bzero(node, sizeof(t_arith_node));
+	node->op = op;
+	node->lhs = lhs;
+	node->rhs = rhs;
+	node->cond = -1;
+	return (p->expr->count++);
+}
+
+static int	parse_primary(t_arith_parser *p)
+{
+	t_arith_tok	*tok;
+	int			idx;
+
+	tok = &p->toks[p->pos];
+	if (tok->op == ARITH_NUM || tok->op == ARITH_VAR)
+	{
+		idx = arith_node(p, tok->op, -1, -1);
+		p->expr->nodes[idx].value = tok->value;
+		p->expr->nodes[idx].name = tok->name;
+		tok->name = NULL;
+		p->pos++;
+		return (idx);
+	}
+	if (tok->op == ARITH_LPAREN)
+	{
+		p->pos++;
+		idx = arith_parse_expr(p);
+		if (!p->error && p->toks[p->pos].op == ARITH_RPAREN)
+		{
+			p->pos++;
+			return (idx);
+		}
+	}
+	p->error = 1;
+	return (-1);
+}
+
+static int	parse_unary(t_arith_parser *p)
+{
+	t_arith_op	op;
+	int			operand;
+
+	op = p->toks[p->pos].op;
+	if (op != ARITH_SUB && op != ARITH_ADD && op != ARITH_NOT
+		&& op != ARITH_BNOT)
+		return (parse_primary(p));
+	p->pos++;
+	operand = parse_unary(p);
+	if (p->error)
+		return (-1);
+	if (op == ARITH_SUB)
+		op = ARITH_NEG;
+	else if (op == ARITH_ADD)
+		op = ARITH_PLUS;
+	return (arith_node(p, op, operand, -1));
+}
+
+/*
+ * `**` is right-associative and binds looser than unary operators
+ */
+int	arith_parse_power(t_arith_parser *p)
+{
+	int	base;
+	int	exponent;
+
+	base = parse_unary(p);
+	if (p->error || p->toks[p->pos].op != ARITH_POW)
+		return (base);
+	p->pos++;
+	exponent = arith_parse_power(p);
+	if (p->error)
+		return (-1);
+	return (arith_node(p, ARITH_POW, base, exponent));
+}
+
+int	arith_binary_level(t_arith_op op)
+{
+	if (op == ARITH_LOR)
+		return (1);
+	if (op == ARITH_LAND)
+		return (2);
+	if (op == ARITH_BOR)
+		return (3);
+	if (op == ARITH_XOR)
+		return (4);
+	if (op == ARITH_BAND)
+		return (5);
+	if (op == ARITH_EQ || op == ARITH_NE)
+		return (6);
+	if (op == ARITH_LT || op == ARITH_GT || op == ARITH_LE || op == ARITH_GE)
+		return (7);
+	if (op == ARITH_SHL || op == ARITH_SHR)
+		return (8);
+	if (op == ARITH_ADD || op == ARITH_SUB)
+		return (9);
+	if (op == ARITH_MUL || op == ARITH_DIV || op == ARITH_MOD)
+		return (10);
+	return (0);
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_brace_args.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:17:24 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 17:17:24 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	count_brace_words(t_command *cmd, t_brace_ctx *b)
+{
+	int		i;
+	int		has_brace;
+	t_brace	br;
+
+	has_brace = 0;
+	i = 0;
+	while (i < cmd->args_count && !b->failed)
+	{
+		if (cmd->args[i] && find_brace(cmd->args[i], &br))
+			has_brace = 1;
+		if (cmd->args[i])
+			brace_walk(b, cmd->args[i], 0);
+		i++;
+	}
+	return (has_brace);
+}
+
+static void	brace_error(t_brace_ctx *b)
+{
+	if (b->bytes > b->limit)
+		ft_fprintf_fd(2, "minishell: brace expansion: %s\n",
+			"argument list too long");
+	else
+		ft_fprintf_fd(2, "minishell: brace expansion: %s\n",
+			strerror(ENOMEM));
+	*expansion_error() = 1;
+}
+
+static void	emit_brace_words(t_command *cmd, t_brace_ctx *b)
+{
+	int	i;
+
+	b->count = 0;
+	i = -1;
+	while (++i < cmd->args_count)
+	{
+		if (cmd->args[i])
+			brace_walk(b, cmd->args[i], 1);
+		cmd->args[i] = NULL;
+	}
+	safe_free((void **)&cmd->args);
+	cmd->args = b->out;
+	cmd->args_count = b->count;
+}
+
+/*
+ * Counts first so argv is allocated exactly once, then generates every
+ * word straight into its final slot. External commands are held to
+ * ARG_MAX; builtins never go through execve() and get a larger budget.
+ */
+void	brace_expand_args(t_command *cmd)
+{
+	t_brace_ctx	b;
+	int			has_brace;
+
+	if (!cmd || !cmd->args)
+		return ;
+	ft_bzero(&b, sizeof(t_brace_ctx));
+	b.limit = sysconf(_SC_ARG_MAX);
+	if (b.limit <= 0)
+		b.limit = BRACE_ARG_MAX;
+	if (command_builtin(cmd))
+		b.limit *= BRACE_BUILTIN_FACTOR;
+	has_brace = count_brace_words(cmd, &b);
+	if (b.failed)
+		return (brace_error(&b));
+	if (!has_brace)
+		return ;
+	b.out = ft_calloc(b.count + 1, sizeof(char *));
+	if (!b.out)
+		return (brace_error(&b));
+	emit_brace_words(cmd, &b);
+	if (b.failed)
+		brace_error(&b);
+}
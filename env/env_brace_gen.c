@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_brace_gen.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:46:29 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:46:29 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	brace_leaf(t_brace_ctx *b, char *word, int owned, size_t len)
+{
+	if (b->failed)
+		return (0);
+	if (!b->out)
+	{
+		b->bytes += len + 1 + sizeof(char *);
+		if (b->bytes > b->limit)
+			b->failed = 1;
+		b->count++;
+		if (owned)
+			free(word);
+		return (!b->failed);
+	}
+	if (!owned)
+		word = ft_strdup(word);
+	if (!word)
+		return (b->failed = 1, 0);
+	b->out[b->count++] = word;
+	return (1);
+}
+
+static char	*brace_join(const char *word, t_brace *br, const char *mid,
+		size_t mid_len)
+{
+	char	*joined;
+	size_t	post_len;
+
+	post_len = ft_strlen(word + br->close + 1);
+	joined = malloc(br->open + mid_len + post_len + 1);
+	if (!joined)
+		return (NULL);
+	ft_memcpy(joined, word, br->open);
+	ft_memcpy(joined + br->open, mid, mid_len);
+	ft_memcpy(joined + br->open + mid_len, word + br->close + 1, post_len + 1);
+	return (joined);
+}
+
+/*
+ * Each alternative is spliced between preamble and postscript. When
+ * neither side holds another brace, the result is final and goes straight
+ * to argv instead of being scanned again. A result that is empty is
+ * dropped, as in bash: `{,}` gives no words, while `{"",}` keeps one.
+ */
+static void	brace_emit(t_brace_ctx *b, const char *word, t_brace *br,
+		t_brace_part *mid)
+{
+	char	*joined;
+	size_t	len;
+
+	len = br->open + mid->len + ft_strlen(word + br->close + 1);
+	if (len == 0)
+		return ;
+	if (br->simple && !b->out)
+	{
+		brace_leaf(b, NULL, 0, len);
+		return ;
+	}
+	joined = brace_join(word, br, mid->text, mid->len);
+	if (!joined)
+	{
+		b->failed = 1;
+		return ;
+	}
+	if (br->simple && !ft_memchr(mid->text, '{', mid->len))
+		brace_leaf(b, joined, 1, len);
+	else
+		brace_walk(b, joined, 1);
+}
+
+static void	brace_walk_items(t_brace_ctx *b, const char *word, t_brace *br)
+{
+	t_brace_part	mid;
+	char			buf[BRACE_ITEM_MAX];
+	long			n;
+	int				i;
+	int				len;
+
+	mid.text = buf;
+	n = -1;
+	i = br->open + 1;
+	while (!b->failed && br->kind == BRACE_RANGE && ++n < br->range.count)
+	{
+		len = format_brace_item(&br->range, n, buf);
+		if (len < 0)
+			b->failed = 1;
+		mid.len = len;
+		if (len >= 0)
+			brace_emit(b, word, br, &mid);
+	}
+	while (!b->failed && br->kind == BRACE_LIST && i <= br->close)
+	{
+		mid.text = (char *)word + i;
+		mid.len = next_brace_comma(word, i, br->close) - i;
+		brace_emit(b, word, br, &mid);
+		i += mid.len + 1;
+	}
+}
+
+void	brace_walk(t_brace_ctx *b, char *word, int owned)
+{
+	t_brace	br;
+
+	if (!find_brace(word, &br))
+	{
+		brace_leaf(b, word, owned, ft_strlen(word));
+		return ;
+	}
+	br.simple = (!ft_memchr(word, '{', br.open)
+			&& !ft_strchr(word + br.close + 1, '{'));
+	if (br.kind == BRACE_RANGE)
+		br.range.count = (br.range.end - br.range.start) / br.range.step;
+	if (br.kind == BRACE_RANGE && br.range.count < 0)
+		br.range.count = -br.range.count;
+	br.range.count++;
+	brace_walk_items(b, word, &br);
+	if (owned)
+		free(word);
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_brace_range.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:28:59 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 10:28:59 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	parse_endpoint(const char *s, int *i, long *value, int *width)
+{
+	int	start;
+	int	neg;
+
+	start = *i;
+	neg = (s[*i] == '-' || s[*i] == '+');
+	*i += neg;
+	if (!ft_isdigit(s[*i]))
+		return (0);
+	if (s[*i] == '0' && ft_isdigit(s[*i + 1]))
+		*width = 1;
+	*value = 0;
+	while (ft_isdigit(s[*i]) && *value < BRACE_RANGE_MAX)
+		*value = *value * 10 + (s[(*i)++] - '0');
+	if (ft_isdigit(s[*i]))
+		return (0);
+	if (s[start] == '-')
+		*value = -*value;
+	if (*width)
+		*width = *i - start;
+	return (1);
+}
+
+static int	parse_numeric_range(const char *s, int i, t_brace *br)
+{
+	int	wa;
+	int	wb;
+
+	wa = 0;
+	wb = 0;
+	br->range.is_char = 0;
+	if (!parse_endpoint(s, &i, &br->range.start, &wa)
+		|| ft_strncmp(s + i, "..", 2) != 0)
+		return (-1);
+	i += 2;
+	if (!parse_endpoint(s, &i, &br->range.end, &wb))
+		return (-1);
+	br->range.width = wa;
+	if (wb > wa)
+		br->range.width = wb;
+	return (i);
+}
+
+static int	parse_char_range(const char *s, int i, t_brace *br)
+{
+	if (!ft_isalpha(s[i]) || ft_strncmp(s + i + 1, "..", 2) != 0
+		|| !ft_isalpha(s[i + 3]))
+		return (-1);
+	br->range.is_char = 1;
+	br->range.width = 0;
+	br->range.start = s[i];
+	br->range.end = s[i + 3];
+	return (i + 4);
+}
+
+int	parse_brace_range(const char *s, t_brace *br)
+{
+	int		i;
+	long	step;
+	int		unused;
+
+	i = parse_numeric_range(s, br->open + 1, br);
+	if (i < 0)
+		i = parse_char_range(s, br->open + 1, br);
+	if (i < 0)
+		return (0);
+	step = 1;
+	unused = 0;
+	if (ft_strncmp(s + i, "..", 2) == 0)
+	{
+		i += 2;
+		if (!parse_endpoint(s, &i, &step, &unused))
+			return (0);
+	}
+	if (i != br->close)
+		return (0);
+	if (step < 0)
+		step = -step;
+	if (step == 0)
+		step = 1;
+	br->range.step = step;
+	return (1);
+}
+
+/*
+ * Writes the n-th element of the range into buf and returns its length
+ */
+int	format_brace_item(t_brace_range *r, long n, char *buf)
+{
+	long	v;
+	int		len;
+	char	*digits;
+
+	if (r->start <= r->end)
+		v = r->start + n * r->step;
+	else
+		v = r->start - n * r->step;
+	if (r->is_char)
+		return (buf[0] = (char)v, buf[1] = '\0', 1);
+	digits = ft_itoa((int)v);
+	if (!digits)
+		return (-1);
+	len = ft_strlen(digits);
+	buf[0] = '\0';
+	if (v < 0)
+		ft_strlcpy(buf, "-", 2);
+	while (len++ < r->width)
+		ft_strlcat(buf, "0", BRACE_ITEM_MAX);
+	ft_strlcat(buf, digits + (v < 0), BRACE_ITEM_MAX);
+	return (safe_free((void **)&digits), ft_strlen(buf));
+}
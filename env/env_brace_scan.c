@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_brace_scan.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:39:52 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 16:39:52 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	skip_quoted(const char *s, int i)
+{
+	char	quote;
+
+	if (s[i] != '\'' && s[i] != '"')
+		return (i);
+	quote = s[i++];
+	while (s[i] && s[i] != quote)
+		i++;
+	if (!s[i])
+		return (i - 1);
+	return (i);
+}
+
+int	match_brace(const char *s, int open)
+{
+	int	depth;
+	int	i;
+
+	depth = 0;
+	i = open;
+	while (s[i])
+	{
+		i = skip_quoted(s, i);
+		if (s[i] == '{')
+			depth++;
+		else if (s[i] == '}' && --depth == 0)
+			return (i);
+		i++;
+	}
+	return (-1);
+}
+
+/*
+ * Returns the index of the next comma at brace depth zero, or `close`
+ */
+int	next_brace_comma(const char *s, int i, int close)
+{
+	int	depth;
+
+	depth = 0;
+	while (i < close)
+	{
+		i = skip_quoted(s, i);
+		if (s[i] == '{')
+			depth++;
+		else if (s[i] == '}')
+			depth--;
+		else if (s[i] == ',' && depth == 0)
+			return (i);
+		i++;
+	}
+	return (close);
+}
+
+int	find_brace(const char *s, t_brace *br)
+{
+	int	i;
+
+	i = 0;
+	while (s[i])
+	{
+		i = skip_quoted(s, i);
+		if (s[i] == '{' && (i == 0 || s[i - 1] != '$'))
+		{
+			br->open = i;
+			br->close = match_brace(s, i);
+			br->kind = BRACE_NONE;
+			if (br->close > 0 && next_brace_comma(s, i + 1, br->close)
+				< br->close)
+				br->kind = BRACE_LIST;
+			else if (br->close > 0 && parse_brace_range(s, br))
+				br->kind = BRACE_RANGE;
+			if (br->kind != BRACE_NONE)
+				return (1);
+		}
+		if (s[i])
+			i++;
+	}
+	return (0);
+}
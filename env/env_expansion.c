@@ -12,23 +12,37 @@
 
 #include "../minishell.h"
 
-void	expand_command_args(t_command *cmd, char **envp)
+int	*expansion_error(void)
+{
+	static int	failed;
+
+	return (&failed);
+}
+
+int	expand_command_args(t_command *cmd, char **envp)
 {
 	t_expand_vars	v;
 
+	*expansion_error() = 0;
+	ft_bzero(&v, sizeof(v));
 	v.cmd = cmd;
 	v.envp = envp;
-	v.i = 0;
-	v.j = 0;
-	v.added = 0;
+	if (cmd)
+		procsubst_expand(cmd, envp);
 	if (cmd && cmd->args && cmd->args_count > 0)
 	{
+		brace_expand_args(cmd);
 		v.is_export = (cmd->args[0] && ft_strcmp(cmd->args[0], "export") == 0);
+		glob_mark_args(cmd);
 		expand_args_loop(&v);
 	}
 	if (cmd)
 	{
 		expand_redirections_loop(&v);
 		clean_empty_args(cmd);
+		glob_expand_args(cmd, envp);
 	}
+	if (*expansion_error())
+		return (-1);
+	return (0);
 }
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:20 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:20 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+void	param_free(t_param *p)
+{
+	safe_free((void **)&p->name);
+	safe_free((void **)&p->word);
+	safe_free((void **)&p->word2);
+	safe_free((void **)&p->value);
+}
+
+/*
+ * Result of the expansion, or NULL when it expands to nothing at all
+ */
+static char	*param_value(t_param *p)
+{
+	if (p->length && p->value)
+		return (ft_itoa(ft_strlen(p->value)));
+	if (p->length)
+		return (ft_strdup("0"));
+	if (!p->op[0] && p->value)
+		return (ft_strdup(p->value));
+	if (ft_strchr("-=+?", p->op[0]))
+		return (param_word_op(p));
+	if (!p->value)
+		return (NULL);
+	if (p->op[0] == ':')
+		return (param_substring(p));
+	if (p->op[0] == '/')
+		return (param_replace(p));
+	if (p->op[0] == '#' || p->op[0] == '%')
+		return (param_remove(p));
+	return (NULL);
+}
+
+static int	bad_substitution(char *body)
+{
+	ft_fprintf_fd(2, "minishell: ${%s}: bad substitution\n", body);
+	*expansion_error() = 1;
+	safe_free((void **)&body);
+	return (1);
+}
+
+static int	append_value(t_var_expand *var_exp, char *value)
+{
+	char	*tmp;
+
+	if (!value)
+		return (1);
+	tmp = var_exp->result;
+	var_exp->result = ft_strjoin(tmp, value);
+	safe_free((void **)&tmp);
+	safe_free((void **)&value);
+	return (var_exp->result != NULL);
+}
+
+/*
+ * str[var_exp->i] is the `{` following a `$`
+ */
+int	expand_param(t_var_expand *var_exp, char *str, char **envp)
+{
+	int		end;
+	char	*body;
+	char	*value;
+	t_param	p;
+
+	end = subst_end(str, var_exp->i - 1);
+	if (end < 0)
+		return (add_char_to_result(&var_exp->result, '$'));
+	body = ft_substr(str, var_exp->i + 1, end - var_exp->i - 2);
+	var_exp->i = end;
+	if (!body)
+		return (0);
+	if (!param_parse(body, &p))
+		return (param_free(&p), bad_substitution(body));
+	safe_free((void **)&body);
+	p.envp = envp;
+	p.value = param_lookup(p.name, envp);
+	value = param_value(&p);
+	param_free(&p);
+	if (!value || !*value)
+		var_exp->is_empty_var = 1;
+	return (append_value(var_exp, value));
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param_assign.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:03:58 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:03:58 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * `${NAME:=word}` runs while the command is being expanded, long before
+ * anything can write the environment; the assignments wait here until
+ * the executor applies them
+ */
+t_strvec	*param_assignments(void)
+{
+	static t_strvec	pending;
+
+	return (&pending);
+}
+
+void	param_assign(const char *name, const char *value)
+{
+	char	*entry;
+	char	*tmp;
+
+	tmp = ft_strjoin(name, "=");
+	if (!tmp)
+		return ;
+	entry = ft_strjoin(tmp, value);
+	safe_free((void **)&tmp);
+	if (entry && !strvec_push(param_assignments(), entry))
+		safe_free((void **)&entry);
+}
+
+/*
+ * The value of NAME, honouring assignments that are still pending
+ */
+char	*param_lookup(const char *name, char **envp)
+{
+	t_strvec	*pending;
+	size_t		len;
+	int			i;
+
+	pending = param_assignments();
+	len = ft_strlen(name);
+	i = pending->count;
+	while (--i >= 0)
+	{
+		if (ft_strncmp(pending->items[i], name, len) == 0
+			&& pending->items[i][len] == '=')
+			return (ft_strdup(pending->items[i] + len + 1));
+	}
+	return (get_env_value((char *)name, envp));
+}
+
+/*
+ * Returns how many were applied, so callers know their envp is stale
+ */
+int	param_apply_assignments(t_env **env_list)
+{
+	t_strvec	*pending;
+	char		*eq;
+	int			i;
+
+	pending = param_assignments();
+	i = 0;
+	while (i < pending->count)
+	{
+		eq = ft_strchr(pending->items[i], '=');
+		*eq = '\0';
+		add_or_update_env(env_list, pending->items[i], eq + 1);
+		i++;
+	}
+	strvec_free(pending);
+	return (i);
+}
+
+/*
+ * Forgets the assignments queued after the first keep. What bash would
+ * assign in a subshell, a pipeline stage or a $(...), never reaches the
+ * shell's environment
+ */
+void	param_drop_assignments(int keep)
+{
+	t_strvec	*pending;
+
+	pending = param_assignments();
+	if (keep <= 0)
+		return (strvec_free(pending));
+	while (pending->count > keep)
+		safe_free((void **)&pending->items[--pending->count]);
+	pending->items[pending->count] = NULL;
+}
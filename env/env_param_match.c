@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param_match.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:26:22 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 14:26:22 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Turns unquoted * ? [ into glob markers and drops the quotes, so quoted
+ * characters match literally
+ */
+static void	mark_pattern(char *s)
+{
+	char	quote;
+	int		i;
+	int		j;
+
+	quote = 0;
+	i = -1;
+	j = 0;
+	while (s[++i])
+	{
+		if (!quote && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (quote && s[i] == quote)
+			quote = 0;
+		else if (!quote && s[i] == '*')
+			s[j++] = GLOB_STAR_MARK;
+		else if (!quote && s[i] == '?')
+			s[j++] = GLOB_ANY_MARK;
+		else if (!quote && s[i] == '[')
+			s[j++] = GLOB_CLASS_MARK;
+		else
+			s[j++] = s[i];
+	}
+	s[j] = '\0';
+}
+
+/*
+ * Compiles the pattern word once for the whole expansion
+ */
+int	param_compile_pattern(const char *word, char **envp, t_glob_pat *pat)
+{
+	char	*src;
+	int		ok;
+
+	src = param_expand_word(word, envp);
+	if (!src)
+		return (0);
+	mark_pattern(src);
+	ok = glob_compile(src, ft_strlen(src), pat);
+	safe_free((void **)&src);
+	return (ok);
+}
+
+/*
+ * For `#` the length of the prefix to remove, for `%` the length to
+ * keep. Shortest matches are tried first unless the operator is doubled.
+ */
+static int	match_cut(t_glob_pat *pat, const char *v, int len, const char *op)
+{
+	int	k;
+	int	step;
+	int	prefix;
+
+	prefix = (op[0] == '#');
+	k = 0;
+	step = 1;
+	if (prefix == (op[1] != '\0'))
+	{
+		k = len;
+		step = -1;
+	}
+	while (k >= 0 && k <= len)
+	{
+		if (prefix && glob_match_n(pat, v, k))
+			return (k);
+		if (!prefix && glob_match_n(pat, v + k, len - k))
+			return (k);
+		k += step;
+	}
+	if (prefix)
+		return (0);
+	return (len);
+}
+
+char	*param_remove(t_param *p)
+{
+	t_glob_pat	pat;
+	int			k;
+
+	if (!param_compile_pattern(p->word, p->envp, &pat))
+		return (NULL);
+	k = match_cut(&pat, p->value, ft_strlen(p->value), p->op);
+	glob_pat_free(&pat);
+	if (p->op[0] == '#')
+		return (ft_strdup(p->value + k));
+	return (ft_strndup(p->value, k));
+}
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param_ops.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:53:21 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:53:21 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+char	*param_expand_word(const char *word, char **envp)
+{
+	char	*out;
+
+	out = expand_variables((char *)word, envp);
+	if (!out)
+		return (ft_strdup(""));
+	return (out);
+}
+
+static char	*param_unset_error(t_param *p)
+{
+	ft_fprintf_fd(2, "minishell: %s: ", p->name);
+	if (*p->word)
+		ft_fprintf_fd(2, "%s\n", p->word);
+	else
+		ft_fprintf_fd(2, "parameter null or not set\n");
+	*expansion_error() = 1;
+	return (ft_strdup(""));
+}
+
+/*
+ * - = + ? and their `:` forms, which also treat an empty value as unset
+ */
+char	*param_word_op(t_param *p)
+{
+	int		unset;
+	char	*word;
+
+	unset = (!p->value || (p->colon && !*p->value));
+	if (p->op[0] == '+' && unset)
+		return (ft_strdup(""));
+	if (p->op[0] == '+')
+		return (param_expand_word(p->word, p->envp));
+	if (!unset)
+		return (ft_strdup(p->value));
+	if (p->op[0] == '?')
+		return (param_unset_error(p));
+	word = param_expand_word(p->word, p->envp);
+	if (word && p->op[0] == '=')
+		param_assign(p->name, word);
+	return (word);
+}
+
+static int	substring_bounds(t_param *p, long long vlen, long long *off,
+		long long *len)
+{
+	const char	*error;
+
+	*len = vlen;
+	error = arith_evaluate(p->word, p->envp, 0, off);
+	if (!error && p->word2)
+		error = arith_evaluate(p->word2, p->envp, 0, len);
+	if (error)
+	{
+		ft_fprintf_fd(2, "minishell: %s: %s\n", p->word, error);
+		*expansion_error() = 1;
+		return (0);
+	}
+	if (*off < 0)
+		*off += vlen;
+	if (*len < 0)
+		*len += vlen - *off;
+	if (*off < 0 || *off > vlen || *len < 0)
+		return (0);
+	if (*len > vlen - *off)
+		*len = vlen - *off;
+	return (1);
+}
+
+/*
+ * ${NAME:off:len}; both bounds are arithmetic and count from the end of
+ * the value when negative
+ */
+char	*param_substring(t_param *p)
+{
+	long long	off;
+	long long	len;
+	char		*raw;
+
+	raw = p->word;
+	p->word = param_expand_word(raw, p->envp);
+	safe_free((void **)&raw);
+	raw = p->word2;
+	if (raw)
+		p->word2 = param_expand_word(raw, p->envp);
+	safe_free((void **)&raw);
+	if (!p->word)
+		return (NULL);
+	if (!substring_bounds(p, ft_strlen(p->value), &off, &len))
+		return (ft_strdup(""));
+	return (ft_substr(p->value, off, len));
+}
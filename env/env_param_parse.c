@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param_parse.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:00:00 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 16:00:00 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	parse_operator(const char *rest, t_param *p)
+{
+	p->colon = (rest[0] == ':' && rest[1] && ft_strchr("-=+?", rest[1]));
+	rest += p->colon;
+	if (!rest[0] || !ft_strchr(":-=+?#%/", rest[0]))
+		return (-1);
+	p->op[0] = rest[0];
+	if ((rest[0] == '#' || rest[0] == '%' || rest[0] == '/')
+		&& rest[1] == rest[0])
+	{
+		p->op[1] = rest[0];
+		return (p->colon + 2);
+	}
+	return (p->colon + 1);
+}
+
+/*
+ * `${NAME/pat/rep}` and `${NAME:off:len}` carry a second word after the
+ * first unquoted separator
+ */
+static int	split_words(const char *word, t_param *p)
+{
+	int	sep;
+
+	sep = -1;
+	if (p->op[0] == '/')
+		sep = find_unquoted(word, '/');
+	else if (p->op[0] == ':')
+		sep = find_unquoted(word, ':');
+	if (sep < 0)
+	{
+		p->word = ft_strdup(word);
+		return (p->word != NULL);
+	}
+	p->word = ft_strndup(word, sep);
+	p->word2 = ft_strdup(word + sep + 1);
+	return (p->word && p->word2);
+}
+
+static int	name_length(const char *s)
+{
+	int	i;
+
+	if (s[0] == '?')
+		return (1);
+	i = 0;
+	while (ft_isalnum(s[i]) || s[i] == '_')
+		i++;
+	return (i);
+}
+
+/*
+ * Splits the text between `${` and `}` into name, operator and words.
+ * Returns 0 on a bad substitution.
+ */
+int	param_parse(const char *body, t_param *p)
+{
+	int	i;
+	int	n;
+
+	ft_bzero(p, sizeof(t_param));
+	p->length = (body[0] == '#' && body[1]);
+	body += p->length;
+	i = name_length(body);
+	p->name = ft_strndup(body, i);
+	if (i == 0 || !p->name)
+		return (0);
+	if (!body[i])
+		return (1);
+	n = parse_operator(body + i, p);
+	if (p->length || n < 0)
+		return (0);
+	return (split_words(body + i + n, p));
+}
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param_replace.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:18:03 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:18:03 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	longest_match_at(t_glob_pat *pat, const char *s, int len)
+{
+	while (len > 0)
+	{
+		if (glob_match_n(pat, s, len))
+			return (len);
+		len--;
+	}
+	return (0);
+}
+
+static int	buf_append(t_subst_buf *buf, const char *s, size_t n)
+{
+	if (!subst_buf_reserve(buf, n))
+		return (0);
+	ft_memcpy(buf->data + buf->len, s, n);
+	buf->len += n;
+	buf->data[buf->len] = '\0';
+	return (1);
+}
+
+static void	replace_matches(t_param *p, t_glob_pat *pat, const char *rep,
+		t_subst_buf *out)
+{
+	int	len;
+	int	i;
+	int	k;
+	int	done;
+
+	len = ft_strlen(p->value);
+	i = 0;
+	done = 0;
+	while (i < len)
+	{
+		k = 0;
+		if (!done)
+			k = longest_match_at(pat, p->value + i, len - i);
+		if (k > 0 && !buf_append(out, rep, ft_strlen(rep)))
+			return ;
+		if (k == 0 && !buf_append(out, p->value + i, 1))
+			return ;
+		if (k > 0 && p->op[1] != '/')
+			done = 1;
+		i += k + (k == 0);
+	}
+}
+
+/*
+ * ${NAME/pat/rep} replaces the first longest match, `//` every match
+ */
+char	*param_replace(t_param *p)
+{
+	t_glob_pat	pat;
+	t_subst_buf	out;
+	char		*rep;
+
+	if (!param_compile_pattern(p->word, p->envp, &pat))
+		return (NULL);
+	if (p->word2)
+		rep = param_expand_word(p->word2, p->envp);
+	else
+		rep = ft_strdup("");
+	ft_bzero(&out, sizeof(t_subst_buf));
+	if (rep && buf_append(&out, "", 0))
+		replace_matches(p, &pat, rep, &out);
+	glob_pat_free(&pat);
+	safe_free((void **)&rep);
+	return (out.data);
+}
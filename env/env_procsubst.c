@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_procsubst.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:38:47 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:38:47 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Index of the next `<(` or `>(` outside quotes and outside `$(...)`, or
+ * -1
+ */
+static int	next_procsubst(const char *s, int i)
+{
+	while (i >= 0 && s[i])
+	{
+		if (s[i] == '\'' || s[i] == '"')
+			i = skip_quoted_text(s, i);
+		else if ((s[i] == '<' || s[i] == '>') && s[i + 1] == '('
+			&& subst_end(s, i) > 0)
+			return (i);
+		else if (s[i] == '$' && (s[i + 1] == '(' || s[i + 1] == '{')
+			&& subst_end(s, i) > 0)
+			i = subst_end(s, i) - 1;
+		if (i >= 0)
+			i++;
+	}
+	return (-1);
+}
+
+static char	*replace_with_path(const char *word, int start, int end, int fd)
+{
+	char	*num;
+	char	*out;
+	size_t	len;
+
+	num = ft_itoa(fd);
+	if (!num)
+		return (NULL);
+	len = start + ft_strlen("/dev/fd/") + ft_strlen(num)
+		+ ft_strlen(word + end);
+	out = malloc(len + 1);
+	if (out)
+	{
+		ft_strlcpy(out, word, start + 1);
+		ft_strlcat(out, "/dev/fd/", len + 1);
+		ft_strlcat(out, num, len + 1);
+		ft_strlcat(out, word + end, len + 1);
+	}
+	safe_free((void **)&num);
+	return (out);
+}
+
+static int	procsubst_word(char **word, char **envp)
+{
+	char	*text;
+	int		fd;
+	int		i;
+	int		end;
+
+	i = next_procsubst(*word, 0);
+	while (i >= 0)
+	{
+		end = subst_end(*word, i);
+		text = ft_substr(*word, i + 2, end - i - 3);
+		fd = -1;
+		if (text)
+			fd = procsubst_start(text, (*word)[i], envp);
+		safe_free((void **)&text);
+		if (fd == -1)
+			return (-1);
+		text = replace_with_path(*word, i, end, fd);
+		if (!text)
+			return (-1);
+		safe_free((void **)word);
+		*word = text;
+		i = next_procsubst(*word, i + 1);
+	}
+	return (0);
+}
+
+/*
+ * Replaces each `<(cmd)` and `>(cmd)` in the words and redirection
+ * targets with the /dev/fd path of a pipe to the running command
+ */
+void	procsubst_expand(t_command *cmd, char **envp)
+{
+	t_redirections	*redir;
+	int				i;
+	int				failed;
+
+	failed = 0;
+	i = -1;
+	while (!failed && cmd->args && ++i < cmd->args_count)
+	{
+		if (cmd->args[i])
+			failed = procsubst_word(&cmd->args[i], envp);
+	}
+	redir = cmd->redirections;
+	while (!failed && redir)
+	{
+		if (redir->type != TOKEN_HEREDOC)
+			failed = procsubst_word(&redir->file, envp);
+		redir = redir->next;
+	}
+	if (failed)
+	{
+		ft_fprintf_fd(2, "minishell: process substitution: %s\n",
+			strerror(errno));
+		*expansion_error() = 1;
+	}
+}
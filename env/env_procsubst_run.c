@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_procsubst_run.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:27:46 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 10:27:46 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static void	procsubst_child(char *text, char **envp, int fds[2], char dir)
+{
+	t_env	*env_list;
+
+	reset_child_signals();
+	if (dup2(fds[dir == '<'], dir == '<') == -1)
+		exit(1);
+	close(fds[0]);
+	close(fds[1]);
+	procsubst_forget();
+	close_shell_fds(NULL);
+	env_list = envp_to_env_list(envp);
+	process_command(text, &env_list);
+	exit(g_last_exit_status);
+}
+
+/*
+ * Forks the command with one end of a pipe as its stdout, for `<(...)`,
+ * or its stdin, for `>(...)`. The shell keeps the other end until the
+ * consuming stage is forked
+ */
+int	procsubst_start(char *text, char dir, char **envp)
+{
+	t_procsubst	*ps;
+	int			fds[2];
+	pid_t		pid;
+
+	ps = procsubst_fds();
+	if (ps->count >= PROCSUBST_MAX)
+		return (errno = EMFILE, -1);
+	if (pipe2(fds, O_CLOEXEC) == -1)
+		return (-1);
+	pid = fork();
+	if (pid == 0)
+		procsubst_child(text, envp, fds, dir);
+	close(fds[dir == '<']);
+	if (pid < 0)
+		return (close(fds[dir == '>']), -1);
+	ps->fds[ps->count] = move_fd_high(fds[dir == '>']);
+	ps->pids[ps->count] = pid;
+	return (ps->fds[ps->count++]);
+}
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_subst.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:04:41 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 10:04:41 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	is_single_word(const char *s, int len)
+{
+	t_state	state;
+	int		i;
+
+	state = STATE_NORMAL;
+	i = 0;
+	while (i < len)
+	{
+		update_quote_state(s[i], &state);
+		if (state == STATE_NORMAL && (ft_isspace(s[i]) || is_operator(s[i])))
+			return (0);
+		i++;
+	}
+	return (len > 0);
+}
+
+/*
+ * The file name of `$(< file)`, expanded and unquoted; NULL when more
+ * than a single word follows the `<`
+ */
+char	*subst_redirect_target(char *text, char **envp)
+{
+	char	*word;
+	char	*plain;
+	int		len;
+
+	while (ft_isspace(*text))
+		text++;
+	len = ft_strlen(text);
+	while (len > 0 && ft_isspace(text[len - 1]))
+		len--;
+	if (!is_single_word(text, len))
+		return (NULL);
+	word = ft_substr(text, 0, len);
+	if (!word || !*word)
+		return (safe_free((void **)&word), NULL);
+	plain = expand_variables(word, envp);
+	safe_free((void **)&word);
+	if (!plain)
+		return (NULL);
+	word = strip_quotes(plain);
+	if (!word)
+		return (plain);
+	return (safe_free((void **)&plain), word);
+}
+
+/*
+ * `$(< file)` is served by reading the file straight into the buffer.
+ * It is opened non-blocking so that a FIFO without a writer yet waits in
+ * subst_read_fd, where Ctrl-C can stop it, rather than in open(2).
+ * Returns 0 when `text` is not of that form.
+ */
+static int	subst_read_file(char *text, char **envp, t_subst_buf *out)
+{
+	char		*name;
+	int			fd;
+	struct stat	st;
+
+	while (ft_isspace(*text))
+		text++;
+	if (text[0] != '<' || text[1] == '<' || text[1] == '(')
+		return (0);
+	name = subst_redirect_target(text + 1, envp);
+	if (!name)
+		return (0);
+	fd = open(name, O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+	g_last_exit_status = (fd < 0);
+	if (fd < 0)
+		ft_fprintf_fd(2, "minishell: %s: %s\n", name, strerror(errno));
+	else if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+		subst_buf_reserve(out, st.st_size);
+	if (fd >= 0)
+		subst_read_fd(fd, out);
+	if (fd >= 0)
+		close(fd);
+	safe_free((void **)&name);
+	return (1);
+}
+
+static void	run_subst(char *text, char **envp, t_subst_buf *out)
+{
+	int	saved_error;
+
+	saved_error = *expansion_error();
+	if (!subst_read_file(text, envp, out)
+		&& !subst_run_builtin(text, envp, out))
+		subst_run_child(text, envp, out);
+	*expansion_error() |= saved_error | *shell_interrupt();
+	while (out->len > 0 && out->data[out->len - 1] == '\n')
+		out->data[--out->len] = '\0';
+}
+
+/*
+ * str[var_exp->i] is the `(` following a `$`. The output of the command
+ * replaces `$(...)`, minus its trailing newlines.
+ */
+int	expand_subst(t_var_expand *var_exp, char *str, char **envp)
+{
+	int			end;
+	char		*text;
+	t_subst_buf	out;
+
+	end = subst_end(str, var_exp->i - 1);
+	if (end < 0)
+		return (add_char_to_result(&var_exp->result, '$'));
+	if (str[var_exp->i + 1] == '(' && str[end - 2] == ')')
+		return (expand_arith(var_exp, str, envp));
+	text = ft_substr(str, var_exp->i + 1, end - var_exp->i - 2);
+	var_exp->i = end;
+	if (!text)
+		return (0);
+	ft_bzero(&out, sizeof(t_subst_buf));
+	run_subst(text, envp, &out);
+	safe_free((void **)&text);
+	if (out.len == 0)
+		var_exp->is_empty_var = 1;
+	if (out.len == 0)
+		return (safe_free((void **)&out.data), 1);
+	text = var_exp->result;
+	var_exp->result = ft_strjoin(text, out.data);
+	safe_free((void **)&text);
+	safe_free((void **)&out.data);
+	return (var_exp->result != NULL);
+}
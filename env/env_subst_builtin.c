@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_subst_builtin.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:40:30 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 18:40:30 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Builtins that only print; running them inside the shell cannot leak
+ * state the way a real subshell would prevent
+ */
+static int	is_pure_builtin(t_command *cmd)
+{
+	const t_builtin	*builtin;
+
+	builtin = command_builtin(cmd);
+	return (builtin && (builtin->flags & BUILTIN_OUTPUT_ONLY));
+}
+
+static t_env	*builtin_env_list(char *name, char **envp)
+{
+	if (ft_strcmp(name, "echo") == 0)
+		return (NULL);
+	return (envp_to_env_list(envp));
+}
+
+static void	run_builtin_captured(t_command *cmd, char **envp, t_subst_buf *out)
+{
+	t_cmd_ctx	ctx;
+	t_env		*env_list;
+	int			fd;
+	int			saved;
+
+	fd = memfd_create("subst", MFD_CLOEXEC);
+	saved = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 0);
+	env_list = builtin_env_list(cmd->args[0], envp);
+	ft_bzero(&ctx, sizeof(t_cmd_ctx));
+	ctx.current = cmd;
+	ctx.env_list = &env_list;
+	g_last_exit_status = 1;
+	if (fd >= 0 && saved >= 0 && dup2(fd, STDOUT_FILENO) != -1)
+	{
+		g_last_exit_status = execute_builtin(&ctx);
+		dup2(saved, STDOUT_FILENO);
+		lseek(fd, 0, SEEK_SET);
+		subst_read_fd(fd, out);
+	}
+	if (fd >= 0)
+		close(fd);
+	if (saved >= 0)
+		close(saved);
+	free_env_list(&env_list);
+}
+
+/*
+ * Like a subshell, the command leaves no ${NAME:=word} assignment
+ * behind; those queued by the enclosing word stay
+ */
+static void	run_expanded(t_command *cmd, char **envp, t_subst_buf *out)
+{
+	int	pending;
+
+	pending = param_assignments()->count;
+	if (expand_command_args(cmd, envp) == -1)
+		g_last_exit_status = 1;
+	else
+		run_builtin_captured(cmd, envp, out);
+	param_drop_assignments(pending);
+}
+
+/*
+ * A substitution made of a single printing builtin without redirections
+ * runs in the shell with stdout pointed at a memfd, so nothing forks.
+ * Returns 0 when the command needs a subshell.
+ */
+int	subst_run_builtin(char *text, char **envp, t_subst_buf *out)
+{
+	t_token		*tokens;
+	t_command	*cmd;
+	int			done;
+
+	tokens = tokenize_input(text);
+	if (!tokens)
+		return (1);
+	assign_token_types(tokens);
+	cmd = create_cmds(&tokens);
+	ft_token_clear(&tokens, free);
+	done = (cmd == NULL);
+	if (!cmd)
+		g_last_exit_status = 2;
+	else if (!cmd->next && !cmd->redirections && is_pure_builtin(cmd))
+	{
+		done = 1;
+		run_expanded(cmd, envp, out);
+	}
+	free_command_list(cmd);
+	return (done);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_subst_run.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:44:00 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 10:44:00 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static void	subst_child(char *text, char **envp, int fds[2])
+{
+	t_env	*env_list;
+
+	reset_child_signals();
+	close(fds[0]);
+	if (dup2(fds[1], STDOUT_FILENO) == -1)
+		exit(1);
+	close(fds[1]);
+	procsubst_forget();
+	close_shell_fds(NULL);
+	env_list = envp_to_env_list(envp);
+	process_command(text, &env_list);
+	exit(g_last_exit_status);
+}
+
+static int	subst_wait(pid_t pid)
+{
+	int	status;
+
+	while (waitpid(pid, &status, 0) == -1)
+	{
+		if (errno != EINTR)
+			return (1);
+	}
+	if (WIFSIGNALED(status))
+		return (128 + WTERMSIG(status));
+	return (WEXITSTATUS(status));
+}
+
+/*
+ * Runs the command in a forked copy of the shell and captures its stdout
+ * through a pipe
+ */
+void	subst_run_child(char *text, char **envp, t_subst_buf *out)
+{
+	int		fds[2];
+	pid_t	pid;
+
+	g_last_exit_status = 1;
+	if (pipe2(fds, O_CLOEXEC) == -1)
+	{
+		ft_fprintf_fd(2, "minishell: pipe: %s\n", strerror(errno));
+		return ;
+	}
+	pid = fork();
+	if (pid == 0)
+		subst_child(text, envp, fds);
+	close(fds[1]);
+	if (pid > 0)
+		subst_read_fd(fds[0], out);
+	close(fds[0]);
+	if (pid < 0)
+		ft_fprintf_fd(2, "minishell: fork: %s\n", strerror(errno));
+	else
+		g_last_exit_status = subst_wait(pid);
+}
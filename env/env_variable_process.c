@@ -22,10 +22,12 @@ static int	process_variable(t_var_expand *var_exp, char *str, char **envp)
 	if (!str[var_exp->i] || ft_isspace(str[var_exp->i])
 		|| str[var_exp->i] == '\"')
 		return (add_char_to_result(&var_exp->result, '$'));
+	if (str[var_exp->i] == '(')
+		return (expand_subst(var_exp, str, envp));
 	var_name = extract_var_name(str, &var_exp->i);
 	if (!var_name)
 		return (0);
-	var_value = get_env_value(var_name, envp);
+	var_value = param_lookup(var_name, envp);
 	safe_free((void **)&var_name);
 	if (!var_value)
 	{
@@ -39,31 +41,54 @@ static int	process_variable(t_var_expand *var_exp, char *str, char **envp)
 	return (var_exp->result != NULL);
 }
 
-static int	handle_character(t_var_expand *var_exp, char *str, char **envp)
+/*
+ * $NAME, $(...) and ${...}; an unquoted result of an argument has its
+ * *, ? and [ marked so that pathname expansion still sees them
+ */
+static int	expand_dollar(t_var_expand *var_exp, char *str, char **envp)
 {
-	if (str[var_exp->i] == '$' && str[var_exp->i + 1])
+	size_t	start;
+	int		ok;
+
+	start = ft_strlen(var_exp->result);
+	if (str[var_exp->i + 1] == '{')
 	{
-		if (!process_variable(var_exp, str, envp))
-			return (0);
+		var_exp->i++;
+		ok = expand_param(var_exp, str, envp);
 	}
 	else
+		ok = process_variable(var_exp, str, envp);
+	if (ok && var_exp->mark_globs && !var_exp->quote && var_exp->result)
+		glob_mark(var_exp->result + start);
+	return (ok);
+}
+
+static int	handle_character(t_var_expand *var_exp, char *str, char **envp)
+{
+	char	c;
+
+	c = str[var_exp->i];
+	if (c == '$' && str[var_exp->i + 1])
+		return (expand_dollar(var_exp, str, envp));
+	if (!var_exp->quote && (c == '\'' || c == '"'))
+		var_exp->quote = c;
+	else if (var_exp->quote == c)
+		var_exp->quote = 0;
+	if (!add_char_to_result(&var_exp->result, c))
 	{
-		if (!add_char_to_result(&var_exp->result, str[var_exp->i]))
-		{
-			safe_free((void **)&var_exp->result);
-			return (0);
-		}
-		var_exp->i++;
+		safe_free((void **)&var_exp->result);
+		return (0);
 	}
+	var_exp->i++;
 	return (1);
 }
 
-char	*expand_variables(char *str, char **envp)
+char	*expand_variables_marked(char *str, char **envp, int mark_globs)
 {
 	t_var_expand	var_exp;
 
-	var_exp.i = 0;
-	var_exp.is_empty_var = 0;
+	ft_bzero(&var_exp, sizeof(t_var_expand));
+	var_exp.mark_globs = mark_globs;
 	var_exp.has_quoted_vars = has_var_in_dquotes(str);
 	var_exp.result = ft_strdup("");
 	if (!var_exp.result)
@@ -81,3 +106,8 @@ char	*expand_variables(char *str, char **envp)
 		return (safe_free((void **)&var_exp.result), NULL);
 	return (var_exp.result);
 }
+
+char	*expand_variables(char *str, char **envp)
+{
+	return (expand_variables_marked(str, envp, 0));
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   child_events.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:09:31 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 18:09:31 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+t_events	*shell_events(void)
+{
+	static t_events	events;
+
+	return (&events);
+}
+
+/*
+ * Created on first use and moved above the fds the user can name. A
+ * forked child drops both with events_close and opens its own set
+ */
+int	events_open(void)
+{
+	t_events			*ev;
+	sigset_t			set;
+	struct epoll_event	add;
+
+	ev = shell_events();
+	if (ev->epfd > 0)
+		return (0);
+	shell_sigmask(&set);
+	ev->epfd = move_fd_high(epoll_create1(EPOLL_CLOEXEC));
+	ev->sigfd = move_fd_high(signalfd(-1, &set, SFD_CLOEXEC | SFD_NONBLOCK));
+	add.events = EPOLLIN;
+	add.data.u64 = EVENT_SIGNAL;
+	if (ev->epfd < 0 || ev->sigfd < 0
+		|| epoll_ctl(ev->epfd, EPOLL_CTL_ADD, ev->sigfd, &add) == -1)
+	{
+		events_close();
+		return (-1);
+	}
+	return (0);
+}
+
+void	events_close(void)
+{
+	t_events	*ev;
+
+	ev = shell_events();
+	if (ev->epfd > 0)
+		close(ev->epfd);
+	if (ev->sigfd > 0)
+		close(ev->sigfd);
+	ft_bzero(ev, sizeof(*ev));
+}
+
+/*
+ * Consumes the signals that arrived while they were blocked and returns
+ * the last one, or 0
+ */
+int	events_drain_signals(void)
+{
+	struct signalfd_siginfo	info;
+	int						last;
+
+	last = 0;
+	if (shell_events()->sigfd <= 0)
+		return (0);
+	while (read(shell_events()->sigfd, &info, sizeof(info))
+		== (ssize_t) sizeof(info))
+		last = info.ssi_signo;
+	return (last);
+}
+
+/*
+ * Without pidfd_open the child is still reaped, by a plain waitpid once
+ * the watched ones are gone
+ */
+void	reaper_watch(pid_t pid)
+{
+	t_events			*ev;
+	struct epoll_event	add;
+	int					fd;
+
+	ev = shell_events();
+	fd = -1;
+	if (pid > 0 && events_open() == 0)
+		fd = move_fd_high(syscall(SYS_pidfd_open, pid, 0));
+	add.events = EPOLLIN;
+	add.data.u64 = ((uint64_t)pid << 32) | (uint32_t)fd;
+	if (fd >= 0 && epoll_ctl(ev->epfd, EPOLL_CTL_ADD, fd, &add) == 0)
+		ev->watched++;
+	else if (pid > 0)
+	{
+		if (fd >= 0)
+			close(fd);
+		ev->untracked++;
+	}
+}
@@ -12,58 +12,54 @@
 
 #include "../minishell.h"
 
-int	is_builtin_command(char *cmd)
-{
-	char	*builtins[8];
-	int		i;
-
-	if (!cmd)
-		return (0);
-	builtins[0] = "cd";
-	builtins[1] = "echo";
-	builtins[2] = "pwd";
-	builtins[3] = "export";
-	builtins[4] = "unset";
-	builtins[5] = "env";
-	builtins[6] = "exit";
-	builtins[7] = NULL;
-	i = -1;
-	while (++i < 7)
-	{
-		if (ft_strcmp(builtins[i], cmd) == 0)
-			return (1);
-	}
-	return (0);
-}
-
 int	execute_builtin(t_cmd_ctx *cmd_ctx)
 {
-	char	*command;
+	const t_builtin	*builtin;
 
-	command = cmd_ctx->current->args[0];
-	if (ft_strcmp(command, "cd") == 0)
-		return (builtin_cd(cmd_ctx->current, cmd_ctx->env_list));
-	else if (ft_strcmp(command, "echo") == 0)
-		return (builtin_echo(cmd_ctx->current));
-	else if (ft_strcmp(command, "pwd") == 0)
-		return (builtin_pwd(cmd_ctx->env_list));
-	else if (ft_strcmp(command, "export") == 0)
-		return (builtin_export(cmd_ctx->current, cmd_ctx->env_list));
-	else if (ft_strcmp(command, "unset") == 0)
-		return (builtin_unset(cmd_ctx->current, cmd_ctx->env_list));
-	else if (ft_strcmp(command, "env") == 0)
-		return (builtin_env(cmd_ctx->current, *cmd_ctx->env_list));
-	else if (ft_strcmp(command, "exit") == 0)
-		return (builtin_exit(cmd_ctx));
-	return (1);
+	builtin = builtin_lookup(cmd_ctx->current->args[0]);
+	if (!builtin)
+		return (1);
+	return (builtin->run(cmd_ctx));
 }
 
-int	is_parent_builtin(char *cmd)
+/*
+ * `exec` keeps its redirections, so it gets no fan-out: a pump could
+ * never finish
+ */
+static int	run_in_frame(t_cmd_ctx *cmd_ctx)
 {
-	return (ft_strcmp(cmd, "cd") == 0 || ft_strcmp(cmd, "export") == 0
-		|| ft_strcmp(cmd, "unset") == 0 || ft_strcmp(cmd, "exit") == 0);
+	t_redirect_frame	frame;
+	int					status;
+	int					is_exec;
+
+	status = 1;
+	is_exec = (cmd_ctx->current->args[0]
+			&& ft_strcmp(cmd_ctx->current->args[0], "exec") == 0);
+	if (prepare_herestrings(cmd_ctx->current) == 0
+		&& (is_exec || prepare_fanouts(cmd_ctx) == 0)
+		&& redirect_frame_apply(&frame, cmd_ctx->current) == 0)
+	{
+		if (cmd_ctx->current->group)
+			status = execute_sequence(cmd_ctx->current->group,
+					cmd_ctx->env_list);
+		else
+			status = execute_builtin(cmd_ctx);
+		if (is_exec)
+			redirect_frame_commit(&frame);
+		else
+			redirect_frame_restore(&frame);
+	}
+	close_fanout_fds(cmd_ctx->current);
+	finish_fanouts(cmd_ctx);
+	procsubst_close_all(!is_exec);
+	return (status);
 }
 
+/*
+ * A lone builtin or `{ ...; }` group runs in the shell, so its
+ * redirections are applied to the shell's own fds inside a frame that is
+ * restored afterwards
+ */
 int	execute_single_parent_builtin(t_cmd_ctx *cmd_ctx)
 {
 	int		status;
@@ -72,10 +68,18 @@ int	execute_single_parent_builtin(t_cmd_ctx *cmd_ctx)
 	envp = env_list_to_envp(*(cmd_ctx->env_list));
 	if (!envp)
 		return (1);
-	expand_command_args(cmd_ctx->current, envp);
+	status = setup_all_heredocs(cmd_ctx->cmd_list, envp);
+	if (status == 0)
+		status = expand_command_args(cmd_ctx->current, envp);
 	safe_doube_star_free(envp);
-	status = execute_builtin(cmd_ctx);
-	if (!ft_strcmp(cmd_ctx->current->args[0], "exit") && status == 2)
+	param_apply_assignments(cmd_ctx->env_list);
+	if (status == 130 || *shell_interrupt())
+		return ((g_last_exit_status = 130));
+	if (status == -1)
+		return (1);
+	status = run_in_frame(cmd_ctx);
+	if (cmd_ctx->current->args[0]
+		&& !ft_strcmp(cmd_ctx->current->args[0], "exit") && status == 2)
 		exit(status);
 	return (status);
 }
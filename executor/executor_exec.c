@@ -69,12 +69,12 @@ void	handle_external_command(t_cmd_ctx *cmd_ctx)
 	char	*path;
 	char	**envp;
 
-	envp = env_list_to_envp(*(cmd_ctx->env_list));
+	envp = stage_envp(cmd_ctx);
 	if (!envp)
 		exit(1);
 	if (cmd_ctx->current->args[0] && ft_strchr(cmd_ctx->current->args[0], '/'))
 		handle_directory_errors(cmd_ctx->current->args[0], envp);
-	path = find_executable_path(cmd_ctx->current->args[0], envp);
+	path = stage_path(cmd_ctx, envp);
 	exec_command(path, cmd_ctx->current, envp);
 	safe_doube_star_free(envp);
 	if (is_path_with_slash(cmd_ctx->current->args[0]))
@@ -95,10 +95,12 @@ void	handle_external_command(t_cmd_ctx *cmd_ctx)
 
 void	execute_single_command(t_cmd_ctx *cmd_ctx)
 {
+	if (cmd_ctx->current->group)
+		exit(execute_sequence(cmd_ctx->current->group, cmd_ctx->env_list));
 	if (cmd_ctx->current->args && cmd_ctx->current->args[0]
 		&& cmd_ctx->current->args[0][0])
 	{
-		if (is_builtin_command(cmd_ctx->current->args[0]))
+		if (command_builtin(cmd_ctx->current))
 			exit(execute_builtin(cmd_ctx));
 		else
 			handle_external_command(cmd_ctx);
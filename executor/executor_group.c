@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_group.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:41:22 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 14:41:22 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Like bash, the rest of a list is dropped only when the shell took the
+ * Ctrl-C itself: in work it does in-process, or while waiting for the
+ * pipeline it killed. A 130 from `(exit 130)` is just a status
+ */
+static int	sequence_interrupted(int status)
+{
+	if (*shell_interrupt())
+		return (1);
+	return (status == 130
+		&& (shell_events()->sigint || shell_interrupted()));
+}
+
+/*
+ * Runs the pipelines in order, each one seeing the status of the one
+ * before it in $?. An interrupted pipeline drops the rest
+ */
+int	execute_sequence(t_sequence *seq, t_env **env_list)
+{
+	while (seq)
+	{
+		g_last_exit_status = execute_command_list(seq->pipeline, env_list);
+		if (sequence_interrupted(g_last_exit_status))
+			break ;
+		seq = seq->next;
+	}
+	return (g_last_exit_status);
+}
+
+/*
+ * A group's heredocs are read with the stage that holds it, before any of
+ * its commands runs and while stdin is still the terminal
+ */
+int	setup_sequence_heredocs(t_sequence *seq, char **envp)
+{
+	int	result;
+
+	while (seq)
+	{
+		result = setup_all_heredocs(seq->pipeline, envp);
+		if (result != 0)
+			return (result);
+		seq = seq->next;
+	}
+	return (0);
+}
+
+static int	setup_command_heredocs(t_command *cmd, char **envp)
+{
+	t_redirections	*redir;
+	int				result;
+
+	redir = cmd->redirections;
+	while (redir)
+	{
+		if (redir->type == TOKEN_HEREDOC && redir->heredoc_fd < 0)
+		{
+			result = handle_heredoc_redir(redir, envp);
+			if (result != 0)
+				return (result);
+		}
+		redir = redir->next;
+	}
+	if (cmd->group)
+		return (setup_sequence_heredocs(cmd->group, envp));
+	return (0);
+}
+
+/*
+ * Heredocs already read for an enclosing group keep their fd
+ */
+int	setup_all_heredocs(t_command *cmd_list, char **envp)
+{
+	t_command	*current;
+	int			result;
+
+	current = cmd_list;
+	while (current)
+	{
+		result = setup_command_heredocs(current, envp);
+		if (result != 0)
+			return (result);
+		current = current->next;
+	}
+	return (0);
+}
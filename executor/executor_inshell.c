@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_inshell.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:18:39 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 13:18:39 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Keeps the stage's pipe ends for run_deferred_stage and hands the read
+ * end of its output pipe to the next stage, as parent_process would
+ */
+pid_t	defer_stage(t_cmd_ctx *cmd_ctx)
+{
+	cmd_ctx->deferred = cmd_ctx->current;
+	cmd_ctx->deferred_fd[0] = cmd_ctx->prev_pipe_read;
+	cmd_ctx->deferred_fd[1] = cmd_ctx->pipe_fd[1];
+	cmd_ctx->prev_pipe_read = cmd_ctx->pipe_fd[0];
+	cmd_ctx->pipe_fd[0] = -1;
+	cmd_ctx->pipe_fd[1] = -1;
+	return (STAGE_IN_SHELL);
+}
+
+/*
+ * Runs once every other stage is forked. SIGPIPE is ignored so a reader
+ * that exits early shows up as EPIPE instead of killing the shell
+ */
+void	run_deferred_stage(t_cmd_ctx *cmd_ctx)
+{
+	t_redirect_frame	frame;
+
+	if (!cmd_ctx->deferred)
+		return ;
+	cmd_ctx->deferred_status = 1;
+	signal(SIGPIPE, SIG_IGN);
+	if (redirect_frame_save(&frame, cmd_ctx->deferred) == 0)
+	{
+		if (cmd_ctx->deferred_fd[0] != -1)
+			dup2(cmd_ctx->deferred_fd[0], STDIN_FILENO);
+		if (cmd_ctx->deferred_fd[1] != -1)
+			dup2(cmd_ctx->deferred_fd[1], STDOUT_FILENO);
+		safe_close(&cmd_ctx->deferred_fd[0]);
+		safe_close(&cmd_ctx->deferred_fd[1]);
+		if (setup_redirections(cmd_ctx->deferred) != -1)
+			cmd_ctx->deferred_status = builtin_cat(cmd_ctx->deferred);
+		redirect_frame_restore(&frame);
+	}
+	close_fanout_fds(cmd_ctx->deferred);
+	safe_close(&cmd_ctx->deferred_fd[0]);
+	safe_close(&cmd_ctx->deferred_fd[1]);
+	signal(SIGPIPE, SIG_DFL);
+}
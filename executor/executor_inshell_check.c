@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_inshell_check.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:16:28 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:16:28 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	is_cat_builtin(t_command *cmd)
+{
+	const t_builtin	*builtin;
+
+	builtin = command_builtin(cmd);
+	return (builtin && builtin->run == run_builtin_cat);
+}
+
+static int	is_regular(const char *path)
+{
+	struct stat	st;
+
+	return (stat(path, &st) == 0 && S_ISREG(st.st_mode));
+}
+
+/*
+ * Whether stdin is sure to reach end of file without the user: another
+ * stage's output, a regular file, a heredoc or a here-string. The last
+ * redirection of fd 0 decides
+ */
+static int	stdin_ends(t_cmd_ctx *cmd_ctx)
+{
+	t_redirections	*redir;
+	int				ends;
+
+	ends = (cmd_ctx->prev_pipe_read != -1);
+	redir = cmd_ctx->current->redirections;
+	while (redir)
+	{
+		if (redirect_target_fd(redir) == STDIN_FILENO)
+			ends = (redir->type == TOKEN_HEREDOC
+					|| redir->type == TOKEN_HERESTRING
+					|| (redir->type == TOKEN_REDIRECT_IN
+						&& is_regular(redir->file)));
+		redir = redir->next;
+	}
+	return (ends);
+}
+
+static int	inputs_end(t_cmd_ctx *cmd_ctx)
+{
+	t_command	*cmd;
+	int			i;
+
+	cmd = cmd_ctx->current;
+	if (cmd->args_count < 2)
+		return (stdin_ends(cmd_ctx));
+	i = 0;
+	while (++i < cmd->args_count)
+	{
+		if (ft_strcmp(cmd->args[i], "-") == 0)
+		{
+			if (!stdin_ends(cmd_ctx))
+				return (0);
+		}
+		else if (!is_regular(cmd->args[i]))
+			return (0);
+	}
+	return (1);
+}
+
+/*
+ * One cat per pipeline runs inside the shell, where SIGINT is blocked,
+ * so only one whose inputs all end by themselves: a terminal, a FIFO or
+ * a device such as /dev/zero is left to a child that Ctrl-C can stop.
+ * So is one in a pipeline with a time limit, so that the timer can stop
+ * it
+ */
+int	can_run_in_shell(t_cmd_ctx *cmd_ctx)
+{
+	return (!cmd_ctx->deferred && is_cat_builtin(cmd_ctx->current)
+		&& procsubst_fds()->count == 0 && shell_events()->pgid == 0
+		&& inputs_end(cmd_ctx));
+}
@@ -20,6 +20,9 @@ static int	setup_pipes_and_heredocs(t_cmd_ctx *cmd_ctx)
 	cmd_ctx->pipe_fd[0] = -1;
 	cmd_ctx->pipe_fd[1] = -1;
 	cmd_ctx->prev_pipe_read = -1;
+	cmd_ctx->deferred = NULL;
+	cmd_ctx->deferred_fd[0] = -1;
+	cmd_ctx->deferred_fd[1] = -1;
 	envp = env_list_to_envp(*(cmd_ctx->env_list));
 	setup_result = setup_all_heredocs(cmd_ctx->cmd_list, envp);
 	safe_doube_star_free(envp);
@@ -35,66 +38,64 @@ static int	setup_pipes_and_heredocs(t_cmd_ctx *cmd_ctx)
 	return (0);
 }
 
-static int	setup_command_pipe(t_cmd_ctx *cmd_ctx)
+/*
+ * Plans every stage, then starts them back to back
+ */
+static pid_t	execute_command_pipeline(t_cmd_ctx *cmd_ctx)
 {
-	if (cmd_ctx->current->next)
-	{
-		if (setup_pipe(cmd_ctx->pipe_fd) == -1)
-		{
-			safe_close(&cmd_ctx->prev_pipe_read);
-			return (0);
-		}
-	}
-	else
-	{
-		cmd_ctx->pipe_fd[0] = -1;
-		cmd_ctx->pipe_fd[1] = -1;
-	}
-	return (1);
+	t_launch	launch;
+	pid_t		last_pid;
+
+	if (launch_plan(cmd_ctx, &launch) == -1)
+		return (-1);
+	last_pid = launch_pipeline(cmd_ctx, &launch);
+	run_deferred_stage(cmd_ctx);
+	launch_report(&launch, *cmd_ctx->env_list);
+	launch_free(&launch);
+	return (last_pid);
 }
 
-static pid_t	execute_command_process(t_cmd_ctx *cmd_ctx)
+/*
+ * Only a lone stage can run in the shell; a `( ... )` subshell or a group
+ * inside a pipeline is forked once and runs its commands in the child.
+ * So is `ulimit ... cmd`, whose limits are for cmd alone. A builtin's
+ * flags say whether it needs the shell or merely does no harm there
+ */
+static int	runs_in_shell(t_command *cmd_list)
 {
-	pid_t	pid;
-	char	**envp;
+	const t_builtin	*builtin;
 
-	envp = env_list_to_envp(*(cmd_ctx->env_list));
-	if (!envp)
-		return (-1);
-	expand_command_args(cmd_ctx->current, envp);
-	if (!setup_command_pipe(cmd_ctx))
-		return (safe_doube_star_free(envp), -1);
-	pid = fork();
-	if (pid == -1)
-		return (handle_fork_error(cmd_ctx), safe_doube_star_free(envp), -1);
-	if (pid == 0)
-		child_process(cmd_ctx);
-	signal(SIGINT, SIG_IGN);
-	safe_doube_star_free(envp);
-	cmd_ctx->prev_pipe_read = parent_process(cmd_ctx->prev_pipe_read,
-			cmd_ctx->pipe_fd);
-	return (pid);
+	if (!cmd_list || cmd_list->next)
+		return (0);
+	if (cmd_list->group_kind == GROUP_BRACE)
+		return (1);
+	if (cmd_list->group_kind != GROUP_NONE || !cmd_list->args
+		|| !cmd_list->args[0])
+		return (0);
+	if (ft_strcmp(cmd_list->args[0], "ulimit") == 0
+		&& ulimit_command_index(cmd_list))
+		return (0);
+	builtin = command_builtin(cmd_list);
+	return (builtin && (builtin->flags & (BUILTIN_PARENT | BUILTIN_NO_FORK)));
 }
 
-static pid_t	execute_command_pipeline(t_cmd_ctx *cmd_ctx,
-		t_command *cmd_list)
+/*
+ * A stage that never ran counts as failed, and the whole pipeline as
+ * interrupted when the shell itself took a Ctrl-C while running it. A
+ * last stage run in the shell took any Ctrl-C the pipeline got
+ */
+static int	pipeline_status(t_cmd_ctx *cmd_ctx, pid_t last_pid, int status)
 {
-	t_command	*last_cmd;
-	pid_t		last_pid;
-
-	last_pid = -1;
-	last_cmd = cmd_list;
-	while (last_cmd && last_cmd->next)
-		last_cmd = last_cmd->next;
-	while (cmd_ctx->current)
-	{
-		if (cmd_ctx->current == last_cmd)
-			last_pid = execute_command_process(cmd_ctx);
-		else
-			execute_command_process(cmd_ctx);
-		cmd_ctx->current = cmd_ctx->current->next;
-	}
-	return (last_pid);
+	if (last_pid == STAGE_IN_SHELL
+		&& (shell_events()->sigint || shell_interrupted()))
+		*shell_interrupt() = 1;
+	if (*shell_interrupt())
+		return (130);
+	if (last_pid == STAGE_SKIPPED)
+		return (1);
+	if (last_pid == STAGE_IN_SHELL)
+		return (cmd_ctx->deferred_status);
+	return (status);
 }
 
 int	execute_command_list(t_command *cmd_list, t_env **env_list)
@@ -103,19 +104,23 @@ int	execute_command_list(t_command *cmd_list, t_env **env_list)
 	int			status;
 	pid_t		last_pid;
 
-	last_pid = -1;
 	cmd_ctx.env_list = env_list;
 	cmd_ctx.cmd_list = cmd_list;
 	cmd_ctx.current = cmd_list;
-	if (cmd_ctx.cmd_list && cmd_ctx.cmd_list->next == NULL
-		&& cmd_ctx.cmd_list->args && cmd_ctx.cmd_list->args[0]
-		&& is_parent_builtin(cmd_ctx.cmd_list->args[0]))
+	cmd_ctx.fanouts = NULL;
+	cmd_ctx.stage = NULL;
+	if (take_pipeline_timeout(cmd_list, *env_list) == -1)
+		return (TIMEOUT_FAILURE);
+	if (shell_events()->limit_ms == 0 && runs_in_shell(cmd_list))
 		return (execute_single_parent_builtin(&cmd_ctx));
 	cmd_ctx.init_result = setup_pipes_and_heredocs(&cmd_ctx);
 	if (cmd_ctx.init_result != 0)
-		return (cmd_ctx.init_result);
-	last_pid = execute_command_pipeline(&cmd_ctx, cmd_list);
-	status = wait_for_specific_pid(last_pid);
-	signal(SIGINT, sigint_handler);
-	return ((cmd_ctx.status = status));
+		return (timeout_finish(cmd_ctx.init_result));
+	timeout_start(*env_list);
+	last_pid = execute_command_pipeline(&cmd_ctx);
+	status = reap_children(last_pid);
+	usage_report(*env_list);
+	finish_fanouts(&cmd_ctx);
+	status = pipeline_status(&cmd_ctx, last_pid, status);
+	return ((cmd_ctx.status = timeout_finish(status)));
 }
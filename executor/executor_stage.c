@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_stage.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:31:50 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 14:31:50 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+int	setup_command_pipe(t_cmd_ctx *cmd_ctx)
+{
+	if (cmd_ctx->current->next)
+	{
+		if (setup_pipe(cmd_ctx->pipe_fd) == -1)
+		{
+			safe_close(&cmd_ctx->prev_pipe_read);
+			return (0);
+		}
+		apply_pipe_size(cmd_ctx->pipe_fd[1], *cmd_ctx->env_list);
+	}
+	else
+	{
+		cmd_ctx->pipe_fd[0] = -1;
+		cmd_ctx->pipe_fd[1] = -1;
+	}
+	return (1);
+}
+
+void	finish_forked_stage(t_cmd_ctx *cmd_ctx)
+{
+	close_fanout_fds(cmd_ctx->current);
+	procsubst_close_all(0);
+	cmd_ctx->prev_pipe_read = parent_process(cmd_ctx->prev_pipe_read,
+			cmd_ctx->pipe_fd);
+}
+
+/*
+ * A stage that failed planning is not started; its pipe is still
+ * created and closed so the next stage reads end-of-file.
+ */
+pid_t	skip_failed_stage(t_cmd_ctx *cmd_ctx)
+{
+	procsubst_close_all(0);
+	if (!setup_command_pipe(cmd_ctx))
+		return (-1);
+	cmd_ctx->prev_pipe_read = parent_process(cmd_ctx->prev_pipe_read,
+			cmd_ctx->pipe_fd);
+	return (STAGE_SKIPPED);
+}
@@ -14,7 +14,7 @@
 
 int	setup_pipe(int pipe_fd[2])
 {
-	if (pipe(pipe_fd) == -1)
+	if (pipe2(pipe_fd, O_CLOEXEC) == -1)
 	{
 		perror("minishell: pipe creation failed");
 		return (-1);
@@ -27,15 +27,11 @@ int	handle_heredoc_redir(t_redirections *redir, char **envp)
 	int	heredoc_fd;
 
 	heredoc_fd = setup_heredoc(redir->file, envp);
-	if (heredoc_fd == 130)
-	{
-		if (heredoc_fd > 0)
-			safe_close(&heredoc_fd);
+	if (heredoc_fd == HEREDOC_INTERRUPTED)
 		return (130);
-	}
 	if (heredoc_fd == -1)
 		return (-1);
-	redir->heredoc_fd = heredoc_fd;
+	redir->heredoc_fd = move_fd_high(heredoc_fd);
 	return (0);
 }
 
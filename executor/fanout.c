@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:40:12 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:40:12 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	is_fanout_member(t_redirections *redir, int fd)
+{
+	return ((redir->type == TOKEN_REDIRECT_OUT || redir->type == TOKEN_APPEND)
+		&& redirect_target_fd(redir) == fd);
+}
+
+static int	group_size(t_redirections *first)
+{
+	t_redirections	*redir;
+	int				count;
+
+	if (first->fanout != FANOUT_NONE
+		|| !is_fanout_member(first, redirect_target_fd(first)))
+		return (0);
+	count = 0;
+	redir = first;
+	while (redir)
+	{
+		count += is_fanout_member(redir, redirect_target_fd(first));
+		redir = redir->next;
+	}
+	return (count);
+}
+
+static int	start_pump(t_fanout *f, t_redirections *lead)
+{
+	int	fds[2];
+
+	if (pipe2(fds, O_CLOEXEC) == -1)
+		return (-1);
+	f->src = move_fd_high(fds[0]);
+	lead->heredoc_fd = move_fd_high(fds[1]);
+	lead->fanout = FANOUT_LEAD;
+	if (pipe2(f->tmp, O_CLOEXEC | O_NONBLOCK) == -1)
+		return (-1);
+	f->tmp[0] = move_fd_high(f->tmp[0]);
+	f->tmp[1] = move_fd_high(f->tmp[1]);
+	if (pthread_create(&f->thread, NULL, fanout_pump, f) != 0)
+		return (-1);
+	f->started = 1;
+	return (0);
+}
+
+/*
+ * Opens the group's files in order and marks them so that
+ * setup_redirections skips all but the last, which installs the pipe
+ */
+static int	open_group(t_fanout *f, t_redirections *first)
+{
+	t_redirections	*redir;
+	t_redirections	*lead;
+
+	redir = first;
+	lead = first;
+	while (redir)
+	{
+		if (is_fanout_member(redir, redirect_target_fd(first)))
+		{
+			f->files[f->count] = move_fd_high(open_redirect_out(redir));
+			if (f->files[f->count] == -1)
+				return (-1);
+			f->count++;
+			redir->fanout = FANOUT_MEMBER;
+			lead = redir;
+		}
+		redir = redir->next;
+	}
+	if (start_pump(f, lead) == -1)
+	{
+		ft_fprintf_fd(2, "minishell: fan-out: %s\n", strerror(errno));
+		return (-1);
+	}
+	return (0);
+}
+
+/*
+ * When a stage sends one fd to several files, the fd becomes a pipe and
+ * a pump thread in the shell copies it into every file
+ */
+int	prepare_fanouts(t_cmd_ctx *cmd_ctx)
+{
+	t_redirections	*redir;
+	t_fanout		*f;
+	int				count;
+
+	redir = cmd_ctx->current->redirections;
+	while (redir)
+	{
+		count = group_size(redir);
+		if (count > 1)
+		{
+			f = fanout_new(cmd_ctx, count);
+			if (!f || open_group(f, redir) == -1)
+			{
+				close_fanout_fds(cmd_ctx->current);
+				return (-1);
+			}
+		}
+		redir = redir->next;
+	}
+	return (0);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout_copy.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:00:23 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:00:23 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Gives the files that missed part of a failed round the rest of it.
+ * src still holds the whole round, less what the last file took if the
+ * failure was there, and the files before round_file already have it
+ */
+static void	finish_round(t_fanout *f, char *buf)
+{
+	ssize_t	taken;
+	ssize_t	skip;
+	int		i;
+
+	taken = 0;
+	if (f->round_file == f->count - 1)
+		taken = f->round_sent;
+	if (read_all(f->src, buf, f->round_len - taken) == -1)
+		return ;
+	i = f->round_file - 1;
+	while (++i < f->count)
+	{
+		skip = 0;
+		if (i == f->round_file)
+			skip = f->round_sent - taken;
+		write_all(f->files[i], buf + skip, f->round_len - taken - skip);
+	}
+}
+
+/*
+ * The read and write fallback of the pump; whatever an earlier round
+ * already wrote is not written again
+ */
+void	fanout_copy(t_fanout *f)
+{
+	char	*buf;
+	ssize_t	n;
+	int		i;
+
+	buf = malloc(FANOUT_CHUNK);
+	if (!buf)
+		return ;
+	n = 1;
+	while (n > 0)
+		n = read(f->tmp[0], buf, FANOUT_CHUNK);
+	if (f->round_len > 0)
+		finish_round(f, buf);
+	while (1)
+	{
+		n = read(f->src, buf, FANOUT_CHUNK);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			break ;
+		i = -1;
+		while (++i < f->count)
+			write_all(f->files[i], buf, n);
+	}
+	free(buf);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout_list.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:46:45 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 12:46:45 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+t_fanout	*fanout_new(t_cmd_ctx *cmd_ctx, int count)
+{
+	t_fanout	*f;
+
+	f = ft_calloc(1, sizeof(t_fanout));
+	if (!f)
+		return (NULL);
+	f->files = malloc(sizeof(int) * count);
+	if (!f->files)
+		return (safe_free((void **)&f), NULL);
+	f->src = -1;
+	f->tmp[0] = -1;
+	f->tmp[1] = -1;
+	f->next = cmd_ctx->fanouts;
+	cmd_ctx->fanouts = f;
+	return (f);
+}
+
+/*
+ * The shell's copy of a group's write end goes once the stage holding
+ * the other copy has it, so the pump sees end-of-file when the stage exits
+ */
+void	close_fanout_fds(t_command *cmd)
+{
+	t_redirections	*redir;
+
+	redir = cmd->redirections;
+	while (redir)
+	{
+		if (redir->fanout == FANOUT_LEAD)
+			safe_close(&redir->heredoc_fd);
+		redir = redir->next;
+	}
+}
+
+/*
+ * Waits for the pumps, so every file is complete before the pipeline's
+ * status is returned
+ */
+void	finish_fanouts(t_cmd_ctx *cmd_ctx)
+{
+	t_fanout	*f;
+
+	while (cmd_ctx->fanouts)
+	{
+		f = cmd_ctx->fanouts;
+		cmd_ctx->fanouts = f->next;
+		if (f->started)
+			pthread_join(f->thread, NULL);
+		safe_close(&f->src);
+		safe_close(&f->tmp[0]);
+		safe_close(&f->tmp[1]);
+		while (f->count > 0)
+			close(f->files[--f->count]);
+		safe_free((void **)&f->files);
+		safe_free((void **)&f);
+	}
+}
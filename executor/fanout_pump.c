@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout_pump.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:01:55 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:01:55 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static ssize_t	splice_all(int from, int to, ssize_t len)
+{
+	ssize_t	n;
+	ssize_t	done;
+
+	done = 0;
+	while (done < len)
+	{
+		n = splice(from, NULL, to, NULL, len - done, SPLICE_F_MOVE);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			break ;
+		done += n;
+	}
+	return (done);
+}
+
+static ssize_t	tee_retry(t_fanout *f, size_t len)
+{
+	ssize_t	n;
+
+	n = tee(f->src, f->tmp[1], len, 0);
+	while (n < 0 && errno == EINTR)
+		n = tee(f->src, f->tmp[1], len, 0);
+	return (n);
+}
+
+/*
+ * One round: tee copies what src holds into tmp without consuming it,
+ * once per file but the last, and the last file takes the data itself.
+ * Returns 1 after a round, 0 at end-of-file and -1 when the kernel
+ * refuses, with the round's progress left in f for fanout_copy
+ */
+static int	pump_round(t_fanout *f)
+{
+	ssize_t	len;
+
+	f->round_len = 0;
+	len = tee_retry(f, FANOUT_CHUNK);
+	if (len <= 0)
+		return ((int)len);
+	f->round_len = len;
+	f->round_file = -1;
+	while (++f->round_file < f->count - 1)
+	{
+		f->round_sent = 0;
+		if (f->round_file > 0 && tee_retry(f, len) != len)
+			return (-1);
+		f->round_sent = splice_all(f->tmp[0], f->files[f->round_file], len);
+		if (f->round_sent != len)
+			return (-1);
+	}
+	f->round_sent = splice_all(f->src, f->files[f->count - 1], len);
+	if (f->round_sent != len)
+		return (-1);
+	return (1);
+}
+
+/*
+ * splice(2) refuses files opened with O_APPEND, so a group with a `>>`
+ * target goes straight to read and write
+ */
+static int	has_append_target(t_fanout *f)
+{
+	int	i;
+	int	flags;
+
+	i = -1;
+	while (++i < f->count)
+	{
+		flags = fcntl(f->files[i], F_GETFL);
+		if (flags == -1 || (flags & O_APPEND))
+			return (1);
+	}
+	return (0);
+}
+
+/*
+ * Runs in its own thread for the lifetime of the stage. Groups the
+ * kernel cannot splice into are served with read and write instead
+ */
+void	*fanout_pump(void *arg)
+{
+	t_fanout	*f;
+	sigset_t	set;
+	int			ret;
+
+	f = arg;
+	sigfillset(&set);
+	pthread_sigmask(SIG_BLOCK, &set, NULL);
+	ret = -1;
+	if (!has_append_target(f))
+		ret = 1;
+	while (ret == 1)
+		ret = pump_round(f);
+	if (ret == -1)
+		fanout_copy(f);
+	return (NULL);
+}
@@ -65,6 +65,7 @@ static void	handle_heredoc_child_process(int pipe_fd[2], char *delimiter,
 	int		quoted;
 	char	*processed_delimiter;
 
+	reset_child_signals();
 	signal(SIGINT, child_sigint_handler);
 	safe_close(&pipe_fd[0]);
 	quoted = is_content_quoted(delimiter);
@@ -77,20 +78,25 @@ static void	handle_heredoc_child_process(int pipe_fd[2], char *delimiter,
 	exit(0);
 }
 
+/*
+ * SIGINT stays blocked in the shell; the one that stopped the reader is
+ * left on the signalfd, dropped here and recorded as the shell's own
+ */
 static int	handle_heredoc_parent(int pipe_fd[2], pid_t pid)
 {
 	int	status;
 
-	signal(SIGINT, SIG_IGN);
 	safe_close(&pipe_fd[1]);
 	waitpid(pid, &status, 0);
-	if ((WIFSIGNALED(status) && WTERMSIG(status) == SIGINT))
+	events_drain_signals();
+	if ((WIFSIGNALED(status) && WTERMSIG(status) == SIGINT)
+		|| (WIFEXITED(status) && WEXITSTATUS(status) == 130))
 	{
 		safe_close(&pipe_fd[0]);
 		g_last_exit_status = 130;
-		return (130);
+		*shell_interrupt() = 1;
+		return (HEREDOC_INTERRUPTED);
 	}
-	signal(SIGINT, sigint_handler);
 	return (pipe_fd[0]);
 }
 
@@ -99,8 +105,7 @@ int	setup_heredoc(char *delimiter, char **envp)
 	int		pipe_fd[2];
 	pid_t	pid;
 
-	signal(SIGINT, heredoc_sigint_handler);
-	if (pipe(pipe_fd) == -1)
+	if (pipe2(pipe_fd, O_CLOEXEC) == -1)
 		return (ft_fprintf_fd(2, "minishell: heredoc pipe error\n"), -1);
 	pid = fork();
 	if (pid == -1)
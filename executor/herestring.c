@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   herestring.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:24:50 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 16:24:50 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Short strings fit in an empty pipe, so the shell can write all of it
+ * before the reader exists
+ */
+static int	herestring_pipe(const char *text)
+{
+	int	fds[2];
+
+	if (pipe2(fds, O_CLOEXEC) == -1)
+		return (-1);
+	if (write_all(fds[1], text, ft_strlen(text)) == -1
+		|| write_all(fds[1], "\n", 1) == -1)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		return (-1);
+	}
+	close(fds[1]);
+	return (fds[0]);
+}
+
+static int	herestring_memfd(const char *text)
+{
+	int	fd;
+
+	fd = memfd_create("herestring", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+	if (fd == -1)
+		return (-1);
+	if (write_all(fd, text, ft_strlen(text)) == -1
+		|| write_all(fd, "\n", 1) == -1
+		|| lseek(fd, 0, SEEK_SET) == -1)
+	{
+		close(fd);
+		return (-1);
+	}
+	fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE
+		| F_SEAL_SEAL);
+	return (fd);
+}
+
+/*
+ * Writes each expanded `<<< word` of the command, plus a newline, into
+ * a descriptor that redirection setup then uses like a heredoc's
+ */
+int	prepare_herestrings(t_command *cmd)
+{
+	t_redirections	*redir;
+
+	redir = cmd->redirections;
+	while (redir)
+	{
+		if (redir->type == TOKEN_HERESTRING)
+		{
+			safe_close(&redir->heredoc_fd);
+			if (ft_strlen(redir->file) < HERESTRING_PIPE_MAX)
+				redir->heredoc_fd = herestring_pipe(redir->file);
+			else
+				redir->heredoc_fd = herestring_memfd(redir->file);
+			redir->heredoc_fd = move_fd_high(redir->heredoc_fd);
+			if (redir->heredoc_fd == -1)
+			{
+				ft_fprintf_fd(2, "minishell: here-string: %s\n",
+					strerror(errno));
+				return (-1);
+			}
+		}
+		redir = redir->next;
+	}
+	return (0);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   launch.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:07:53 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 20:07:53 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * The fork half of what execute_command_process used to do, for a stage
+ * that is already planned
+ */
+static pid_t	launch_stage(t_cmd_ctx *cmd_ctx, t_launch *launch)
+{
+	pid_t	pid;
+
+	*procsubst_fds() = cmd_ctx->stage->procsubst;
+	if (cmd_ctx->stage->failed || *shell_interrupt())
+		return (skip_failed_stage(cmd_ctx));
+	if (!setup_command_pipe(cmd_ctx))
+		return (procsubst_close_all(0), -1);
+	if (can_run_in_shell(cmd_ctx))
+		return (defer_stage(cmd_ctx));
+	pid = spawn_stage(cmd_ctx);
+	if (pid == -1)
+		return (handle_fork_error(cmd_ctx), procsubst_close_all(0), -1);
+	launch->last_us = monotonic_us();
+	if (launch->first_us == 0)
+		launch->first_us = launch->last_us;
+	process_group_track(pid);
+	reaper_watch(pid);
+	finish_forked_stage(cmd_ctx);
+	return (pid);
+}
+
+/*
+ * Returns what the last stage gave: its pid, STAGE_SKIPPED,
+ * STAGE_IN_SHELL or -1
+ */
+pid_t	launch_pipeline(t_cmd_ctx *cmd_ctx, t_launch *launch)
+{
+	pid_t	last_pid;
+	int		i;
+
+	last_pid = -1;
+	i = 0;
+	cmd_ctx->current = cmd_ctx->cmd_list;
+	while (cmd_ctx->current)
+	{
+		cmd_ctx->stage = &launch->stages[i++];
+		last_pid = launch_stage(cmd_ctx, launch);
+		cmd_ctx->current = cmd_ctx->current->next;
+	}
+	cmd_ctx->stage = NULL;
+	return (last_pid);
+}
+
+/*
+ * With LAUNCH_STATS set, prints the planning time and the skew between
+ * the first and the last stage forked
+ */
+void	launch_report(t_launch *launch, t_env *env_list)
+{
+	t_env	*node;
+	char	*num[3];
+
+	node = find_env_node(env_list, "LAUNCH_STATS");
+	if (!node || !node->value || !node->value[0])
+		return ;
+	num[0] = ft_itoa(launch->count);
+	num[1] = ft_itoa((int)launch->plan_us);
+	num[2] = ft_itoa((int)(launch->last_us - launch->first_us));
+	if (num[0] && num[1] && num[2])
+		ft_fprintf_fd(2, "minishell: launch: %s stages, planned in %s us, "
+			"skew %s us\n", num[0], num[1], num[2]);
+	safe_free((void **)&num[0]);
+	safe_free((void **)&num[1]);
+	safe_free((void **)&num[2]);
+}
+
+/*
+ * In a child: the environment planned for its stage, or the shell's
+ * when the stage was not planned
+ */
+char	**stage_envp(t_cmd_ctx *cmd_ctx)
+{
+	if (cmd_ctx->stage && cmd_ctx->stage->envp)
+		return (cmd_ctx->stage->envp);
+	return (env_list_to_envp(*(cmd_ctx->env_list)));
+}
+
+char	*stage_path(t_cmd_ctx *cmd_ctx, char **envp)
+{
+	if (cmd_ctx->stage && cmd_ctx->stage->path)
+		return (cmd_ctx->stage->path);
+	return (find_executable_path(cmd_ctx->current->args[0], envp));
+}
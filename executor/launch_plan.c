@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   launch_plan.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:35:57 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:35:57 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Input redirections are checked up to the first one the child would
+ * treat differently: an output, a dup, an ambiguous word or an fd out of
+ * range. Those, and everything after them, are still left to the child
+ */
+static int	is_checkable(t_redirections *redir)
+{
+	int	i;
+
+	if (redir->type != TOKEN_REDIRECT_IN && redir->type != TOKEN_HEREDOC
+		&& redir->type != TOKEN_HERESTRING)
+		return (0);
+	if (redirect_target_fd(redir) >= REDIRECT_FRAME_MIN_FD)
+		return (0);
+	if (redir->type != TOKEN_REDIRECT_IN || redir->was_in_squotes
+		|| redir->was_in_dquotes)
+		return (1);
+	i = 0;
+	while (redir->file[i] && !ft_isspace(redir->file[i]))
+		i++;
+	return (i > 0 && redir->file[i] == '\0');
+}
+
+/*
+ * A missing input file is reported in stage order before anything runs,
+ * in the words the child would have used
+ */
+static int	check_redirections(t_command *cmd)
+{
+	t_redirections	*redir;
+
+	redir = cmd->redirections;
+	while (redir && is_checkable(redir))
+	{
+		if (redir->type == TOKEN_REDIRECT_IN
+			&& access(redir->file, R_OK) == -1)
+			return (ft_fprintf_fd(2, "minishell: "), perror(redir->file), -1);
+		redir = redir->next;
+	}
+	return (0);
+}
+
+/*
+ * Expands the stage and resolves its executable. Its process
+ * substitutions are put aside until it is launched, so that the table
+ * only ever holds the fds of the stage being forked. A stage is a
+ * subshell: its ${NAME:=word} assignments are dropped, not applied
+ */
+static void	plan_stage(t_cmd_ctx *cmd_ctx, t_stage *st)
+{
+	t_command	*cmd;
+
+	cmd = cmd_ctx->current;
+	st->cmd = cmd;
+	st->envp = env_list_to_envp(*cmd_ctx->env_list);
+	if (!st->envp || expand_command_args(cmd, st->envp) == -1
+		|| prepare_herestrings(cmd) == -1 || check_redirections(cmd) == -1
+		|| prepare_fanouts(cmd_ctx) == -1)
+		st->failed = 1;
+	param_drop_assignments(0);
+	if (!st->failed && st->envp && !cmd->group && cmd->args && cmd->args[0]
+		&& cmd->args[0][0] && !command_builtin(cmd))
+		st->path = find_executable_path(cmd->args[0], st->envp);
+	st->procsubst = *procsubst_fds();
+	procsubst_fds()->count = 0;
+}
+
+/*
+ * Every stage is expanded and resolved before the first fork, so the
+ * stages then start back to back and expansion errors come out in order
+ */
+int	launch_plan(t_cmd_ctx *cmd_ctx, t_launch *launch)
+{
+	t_command	*cmd;
+	long		start;
+	int			i;
+
+	ft_bzero(launch, sizeof(*launch));
+	start = monotonic_us();
+	cmd = cmd_ctx->cmd_list;
+	while (cmd)
+	{
+		launch->count++;
+		cmd = cmd->next;
+	}
+	launch->stages = ft_calloc(launch->count + 1, sizeof(t_stage));
+	if (!launch->stages)
+		return (-1);
+	i = 0;
+	cmd_ctx->current = cmd_ctx->cmd_list;
+	while (cmd_ctx->current)
+	{
+		plan_stage(cmd_ctx, &launch->stages[i++]);
+		cmd_ctx->current = cmd_ctx->current->next;
+	}
+	cmd_ctx->current = cmd_ctx->cmd_list;
+	launch->plan_us = monotonic_us() - start;
+	return (0);
+}
+
+void	launch_free(t_launch *launch)
+{
+	int	i;
+
+	i = -1;
+	while (launch->stages && ++i < launch->count)
+	{
+		safe_doube_star_free(launch->stages[i].envp);
+		safe_free((void **)&launch->stages[i].path);
+	}
+	safe_free((void **)&launch->stages);
+}
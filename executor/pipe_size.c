@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_size.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:50:02 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 17:50:02 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Parses sizes such as 65536, 256k or 1M; returns 0 when invalid
+ */
+static long	parse_pipe_size(const char *s)
+{
+	long	size;
+
+	size = 0;
+	if (!ft_isdigit(*s))
+		return (0);
+	while (ft_isdigit(*s) && size <= INT_MAX)
+		size = size * 10 + (*s++ - '0');
+	if (*s == 'k' || *s == 'K')
+		size <<= 10;
+	else if (*s == 'm' || *s == 'M')
+		size <<= 20;
+	else if (*s == 'g' || *s == 'G')
+		size <<= 30;
+	if (*s && s[1])
+		return (0);
+	if (*s && !ft_strchr("kKmMgG", *s))
+		return (0);
+	return (size);
+}
+
+/*
+ * The largest size an unprivileged process may request, read once
+ */
+static long	pipe_max_size(void)
+{
+	static long	max_size;
+	char		buf[32];
+	ssize_t		n;
+	int			fd;
+
+	if (max_size > 0)
+		return (max_size);
+	max_size = PIPESIZE_DEFAULT_MAX;
+	fd = open("/proc/sys/fs/pipe-max-size", O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return (max_size);
+	n = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (n > 0)
+	{
+		buf[n] = '\0';
+		if (ft_atoi(buf) > 0)
+			max_size = ft_atoi(buf);
+	}
+	return (max_size);
+}
+
+/*
+ * Applies the PIPESIZE variable to a pipeline pipe. Requests beyond
+ * /proc/sys/fs/pipe-max-size are clamped; failures keep the default.
+ */
+void	apply_pipe_size(int fd, t_env *env_list)
+{
+	t_env	*node;
+	long	size;
+
+	node = find_env_node(env_list, "PIPESIZE");
+	if (!node || !node->value)
+		return ;
+	size = parse_pipe_size(node->value);
+	if (size <= 0)
+		return ;
+	if (size > pipe_max_size())
+		size = pipe_max_size();
+	fcntl(fd, F_SETPIPE_SZ, (int)size);
+}
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   process_group.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:50:52 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:50:52 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * In the child, before its signals are reset: a timed pipeline runs in
+ * its own process group so the timer can signal all of it, and that
+ * group takes the terminal when the shell had it
+ */
+void	process_group_join(void)
+{
+	t_events	*ev;
+	pid_t		pgid;
+
+	ev = shell_events();
+	if (ev->pgid == 0)
+		return ;
+	pgid = ev->pgid;
+	if (pgid < 0)
+		pgid = 0;
+	setpgid(0, pgid);
+	if (ev->tty)
+		tcsetpgrp(STDIN_FILENO, getpgrp());
+}
+
+/*
+ * The parent makes the same calls, so the group exists whichever of the
+ * two runs first. The first stage's pid names the group
+ */
+void	process_group_track(pid_t pid)
+{
+	t_events	*ev;
+
+	ev = shell_events();
+	if (ev->pgid == 0 || pid <= 0)
+		return ;
+	if (ev->pgid < 0)
+		ev->pgid = pid;
+	setpgid(pid, ev->pgid);
+	if (ev->tty)
+		tcsetpgrp(STDIN_FILENO, ev->pgid);
+}
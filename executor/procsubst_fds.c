@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   procsubst_fds.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:43:28 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:43:28 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Shell ends of the pipes made by `<(...)` and `>(...)` for the stage
+ * being started, with the pids of their commands
+ */
+t_procsubst	*procsubst_fds(void)
+{
+	static t_procsubst	ps;
+
+	return (&ps);
+}
+
+/*
+ * Closes every fd from REDIRECT_FRAME_MIN_FD up. With keep, the stage's
+ * process substitution fds survive and lose close-on-exec so the command
+ * can open their /dev/fd paths
+ */
+void	close_high_fds(int keep)
+{
+	t_procsubst	*ps;
+	int			lo;
+	int			next;
+	int			i;
+
+	ps = procsubst_fds();
+	lo = REDIRECT_FRAME_MIN_FD;
+	while (keep)
+	{
+		next = INT_MAX;
+		i = -1;
+		while (++i < ps->count)
+		{
+			if (ps->fds[i] >= lo && ps->fds[i] < next)
+				next = ps->fds[i];
+		}
+		if (next == INT_MAX)
+			break ;
+		if (next > lo)
+			close_range(lo, next - 1, 0);
+		fcntl(next, F_SETFD, 0);
+		lo = next + 1;
+	}
+	close_range(lo, ~0U, 0);
+}
+
+/*
+ * Called once the consuming stage has its copies. With wait, the
+ * commands are reaped here, for stages that are not followed by
+ * reap_children; otherwise they are watched with the stage
+ */
+void	procsubst_close_all(int wait)
+{
+	t_procsubst	*ps;
+
+	ps = procsubst_fds();
+	while (ps->count > 0)
+	{
+		ps->count--;
+		close(ps->fds[ps->count]);
+		if (wait)
+			waitpid(ps->pids[ps->count], NULL, 0);
+		else
+			reaper_watch(ps->pids[ps->count]);
+	}
+}
+
+/*
+ * For a forked child: the commands belong to the shell that started
+ * them, so only the fds are dropped
+ */
+void	procsubst_forget(void)
+{
+	t_procsubst	*ps;
+
+	ps = procsubst_fds();
+	while (ps->count > 0)
+		close(ps->fds[--ps->count]);
+}
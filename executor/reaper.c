@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reaper.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:27:21 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:27:21 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	handle_process_status(pid_t pid, int status, pid_t last_pid)
+{
+	int	last_command_status;
+	int	exit_status;
+
+	last_command_status = 0;
+	exit_status = 0;
+	if (pid == last_pid)
+	{
+		if (WIFEXITED(status))
+			last_command_status = WEXITSTATUS(status);
+		else if (WIFSIGNALED(status))
+			last_command_status = 128 + WTERMSIG(status);
+	}
+	if (WIFSIGNALED(status))
+	{
+		exit_status = 128 + WTERMSIG(status);
+		if (WTERMSIG(status) == SIGQUIT && g_last_exit_status != 131)
+			write(STDERR_FILENO, "Quit: 3\n", 9);
+		if (WTERMSIG(status) == SIGINT)
+			write(STDOUT_FILENO, "\n", 1);
+	}
+	else if (WIFEXITED(status))
+		exit_status = WEXITSTATUS(status);
+	if (pid == last_pid)
+		return (last_command_status);
+	return (exit_status);
+}
+
+static void	add_usage(struct rusage *sum, struct rusage *ru)
+{
+	timeradd(&sum->ru_utime, &ru->ru_utime, &sum->ru_utime);
+	timeradd(&sum->ru_stime, &ru->ru_stime, &sum->ru_stime);
+	if (ru->ru_maxrss > sum->ru_maxrss)
+		sum->ru_maxrss = ru->ru_maxrss;
+}
+
+/*
+ * A pidfd is readable once its child has exited, so wait4 does not
+ * block here
+ */
+static void	handle_event(t_events *ev, uint64_t key, pid_t last_pid)
+{
+	struct rusage	ru;
+	pid_t			pid;
+	int				fd;
+	int				status;
+
+	if (key == EVENT_SIGNAL)
+	{
+		ev->sigint |= (events_drain_signals() == SIGINT);
+		return ;
+	}
+	if (key == EVENT_TIMER)
+		return (timeout_expired(ev));
+	pid = (pid_t)(key >> 32);
+	fd = (int)(uint32_t)key;
+	epoll_ctl(ev->epfd, EPOLL_CTL_DEL, fd, NULL);
+	close(fd);
+	ev->watched--;
+	if (wait4(pid, &status, 0, &ru) != pid)
+		return ;
+	add_usage(&ev->usage, &ru);
+	if (pid == last_pid || last_pid == -1)
+		ev->status = handle_process_status(pid, status, last_pid);
+	else
+		handle_process_status(pid, status, -1);
+}
+
+static void	reap_untracked(t_events *ev, pid_t last_pid)
+{
+	struct rusage	ru;
+	pid_t			pid;
+	int				status;
+
+	while (ev->untracked > 0)
+	{
+		pid = wait4(-1, &status, 0, &ru);
+		if (pid == -1 && errno == EINTR)
+			continue ;
+		if (pid == -1)
+			break ;
+		ev->untracked--;
+		add_usage(&ev->usage, &ru);
+		if (pid == last_pid || last_pid == -1)
+			ev->status = handle_process_status(pid, status, last_pid);
+		else
+			handle_process_status(pid, status, -1);
+	}
+	ev->untracked = 0;
+}
+
+/*
+ * Reaps every watched child as it exits, rather than blocking in
+ * waitpid(-1) until the last one is gone. SIGINT and SIGQUIT reach the
+ * shell on the signalfd; the children get them from the terminal
+ */
+int	reap_children(pid_t last_pid)
+{
+	t_events			*ev;
+	struct epoll_event	events[EVENTS_MAX];
+	int					n;
+
+	ev = shell_events();
+	ev->status = -1;
+	ev->sigint = 0;
+	ft_bzero(&ev->usage, sizeof(ev->usage));
+	while (ev->watched > 0)
+	{
+		n = epoll_wait(ev->epfd, events, EVENTS_MAX, -1);
+		if (n == -1 && errno != EINTR)
+			break ;
+		while (n-- > 0)
+			handle_event(ev, events[n].data.u64, last_pid);
+	}
+	reap_untracked(ev, last_pid);
+	if (ev->status == -1)
+		ev->status = 0;
+	return (ev->status);
+}
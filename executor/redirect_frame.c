@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redirect_frame.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:38:47 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 12:38:47 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+void	redirect_frame_restore(t_redirect_frame *frame)
+{
+	int	fd;
+
+	fd = -1;
+	while (++fd < REDIRECT_FRAME_MIN_FD)
+	{
+		if (frame->saved[fd] == REDIRECT_FRAME_UNUSED)
+			continue ;
+		if (frame->saved[fd] == -1)
+			close(fd);
+		else
+			dup2(frame->saved[fd], fd);
+		safe_close(&frame->saved[fd]);
+	}
+}
+
+/*
+ * Used by `exec`: the redirections stay and the saved copies are dropped
+ */
+void	redirect_frame_commit(t_redirect_frame *frame)
+{
+	int	fd;
+
+	fd = -1;
+	while (++fd < REDIRECT_FRAME_MIN_FD)
+	{
+		if (frame->saved[fd] >= 0)
+			safe_close(&frame->saved[fd]);
+	}
+}
+
+static int	save_fd(t_redirect_frame *frame, int fd)
+{
+	if (frame->saved[fd] != REDIRECT_FRAME_UNUSED)
+		return (0);
+	frame->saved[fd] = fcntl(fd, F_DUPFD_CLOEXEC, REDIRECT_FRAME_MIN_FD);
+	if (frame->saved[fd] == -1 && errno != EBADF)
+	{
+		ft_fprintf_fd(2, "minishell: cannot save descriptor %d: %s\n",
+			fd, strerror(errno));
+		frame->saved[fd] = REDIRECT_FRAME_UNUSED;
+		redirect_frame_commit(frame);
+		return (-1);
+	}
+	return (0);
+}
+
+/*
+ * Copies of the standard fds, and of any fd the command redirects, go at
+ * REDIRECT_FRAME_MIN_FD or above so they stay out of the way of the
+ * redirections. A fd that was closed is recorded as -1 and closed again
+ * on restore
+ */
+int	redirect_frame_save(t_redirect_frame *frame, t_command *cmd)
+{
+	t_redirections	*redir;
+	int				fd;
+
+	fd = -1;
+	while (++fd < REDIRECT_FRAME_MIN_FD)
+		frame->saved[fd] = REDIRECT_FRAME_UNUSED;
+	fd = -1;
+	while (++fd <= STDERR_FILENO)
+	{
+		if (save_fd(frame, fd) == -1)
+			return (-1);
+	}
+	redir = cmd->redirections;
+	while (redir)
+	{
+		fd = redirect_target_fd(redir);
+		if (fd < REDIRECT_FRAME_MIN_FD && save_fd(frame, fd) == -1)
+			return (-1);
+		redir = redir->next;
+	}
+	return (0);
+}
+
+/*
+ * Lets a builtin run in the shell process with its redirections; when
+ * one fails the frame is already restored
+ */
+int	redirect_frame_apply(t_redirect_frame *frame, t_command *cmd)
+{
+	if (redirect_frame_save(frame, cmd) == -1)
+		return (-1);
+	if (setup_redirections(cmd) == -1)
+	{
+		redirect_frame_restore(frame);
+		return (-1);
+	}
+	return (0);
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timeout.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:58:07 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:58:07 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static void	arm_timer(int fd, long ms)
+{
+	struct itimerspec	spec;
+
+	ft_bzero(&spec, sizeof(spec));
+	spec.it_value.tv_sec = ms / 1000;
+	spec.it_value.tv_nsec = (ms % 1000) * 1000000;
+	if (ms <= 0)
+		spec.it_value.tv_nsec = 1;
+	timerfd_settime(fd, 0, &spec, NULL);
+}
+
+/*
+ * Arms the pipeline's timer before its first stage is forked. TMOUT_CMD
+ * gives the limit for pipelines that asked for none
+ */
+void	timeout_start(t_env *env_list)
+{
+	t_events			*ev;
+	t_env				*node;
+	struct epoll_event	add;
+
+	ev = shell_events();
+	node = find_env_node(env_list, "TMOUT_CMD");
+	if (ev->limit_ms == 0 && node && node->value
+		&& parse_duration(node->value, &ev->limit_ms) == -1)
+		ev->limit_ms = 0;
+	if (ev->limit_ms <= 0 || events_open() == -1)
+		return ;
+	ev->timerfd = move_fd_high(timerfd_create(CLOCK_MONOTONIC,
+				TFD_CLOEXEC | TFD_NONBLOCK));
+	add.events = EPOLLIN;
+	add.data.u64 = EVENT_TIMER;
+	if (ev->timerfd < 0
+		|| epoll_ctl(ev->epfd, EPOLL_CTL_ADD, ev->timerfd, &add) == -1)
+		return ((void)timeout_finish(0));
+	ev->pgid = -1;
+	ev->tty = (isatty(STDIN_FILENO)
+			&& tcgetpgrp(STDIN_FILENO) == getpgrp());
+	arm_timer(ev->timerfd, ev->limit_ms);
+}
+
+/*
+ * SIGTERM first, with SIGCONT for stopped members, then SIGKILL once the
+ * grace period has passed too
+ */
+void	timeout_expired(t_events *ev)
+{
+	uint64_t	ticks;
+
+	if (read(ev->timerfd, &ticks, sizeof(ticks)) != sizeof(ticks)
+		|| ev->pgid <= 0)
+		return ;
+	ev->expired++;
+	if (ev->expired == 1)
+	{
+		killpg(ev->pgid, SIGTERM);
+		killpg(ev->pgid, SIGCONT);
+		arm_timer(ev->timerfd, ev->grace_ms);
+	}
+	else if (ev->expired == 2)
+		killpg(ev->pgid, SIGKILL);
+}
+
+/*
+ * Takes the terminal back and drops the timer. A pipeline stopped by the
+ * timer exits 124, or 137 when it had to be killed
+ */
+int	timeout_finish(int status)
+{
+	t_events	*ev;
+
+	ev = shell_events();
+	if (ev->tty)
+		tcsetpgrp(STDIN_FILENO, getpgrp());
+	if (ev->timerfd > 0)
+	{
+		epoll_ctl(ev->epfd, EPOLL_CTL_DEL, ev->timerfd, NULL);
+		close(ev->timerfd);
+	}
+	if (ev->expired == 1)
+		status = TIMEOUT_STATUS;
+	else if (ev->expired > 1)
+		status = 128 + SIGKILL;
+	ev->timerfd = 0;
+	ev->limit_ms = 0;
+	ev->pgid = 0;
+	ev->tty = 0;
+	ev->expired = 0;
+	return (status);
+}
+
+long	monotonic_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000L + ts.tv_nsec / 1000);
+}
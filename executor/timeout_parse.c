@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timeout_parse.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:35:41 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 13:35:41 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	apply_unit(const char *unit, long *ms)
+{
+	if (*unit == '\0' || ft_strcmp(unit, "s") == 0)
+		return (0);
+	if (ft_strcmp(unit, "m") == 0)
+		*ms *= 60;
+	else if (ft_strcmp(unit, "h") == 0)
+		*ms *= 3600;
+	else if (ft_strcmp(unit, "d") == 0)
+		*ms *= 86400;
+	else
+		return (-1);
+	return (0);
+}
+
+/*
+ * Accepts timeout(1)'s DURATION: a number of seconds with an optional
+ * fraction and an s, m, h or d suffix. Kept to the millisecond
+ */
+int	parse_duration(const char *s, long *ms)
+{
+	long	whole;
+	long	frac;
+	long	scale;
+
+	whole = 0;
+	frac = 0;
+	scale = 1;
+	if (!ft_isdigit(*s) && !(*s == '.' && ft_isdigit(s[1])))
+		return (-1);
+	while (ft_isdigit(*s) && whole < 100000000)
+		whole = whole * 10 + (*s++ - '0');
+	if (*s == '.')
+	{
+		while (ft_isdigit(*++s) && scale < 1000)
+		{
+			frac = frac * 10 + (*s - '0');
+			scale *= 10;
+		}
+		while (ft_isdigit(*s))
+			s++;
+	}
+	*ms = whole * 1000 + frac * 1000 / scale;
+	return (apply_unit(s, ms));
+}
+
+static int	timeout_operand(char *raw, char **envp, long *ms)
+{
+	char	*expanded;
+	char	*text;
+	int		ret;
+
+	ret = -1;
+	expanded = expand_variables(raw, envp);
+	text = NULL;
+	if (expanded)
+		text = strip_quotes(expanded);
+	if (text)
+		ret = parse_duration(text, ms);
+	if (ret == -1)
+		ft_fprintf_fd(2, "minishell: timeout: invalid time interval `%s'\n",
+			raw);
+	safe_free((void **)&expanded);
+	safe_free((void **)&text);
+	return (ret);
+}
+
+/*
+ * `timeout [-k GRACE] DURATION cmd...` leaves cmd as the stage. The words
+ * are taken before expansion because the limit must be known before the
+ * first stage is forked
+ */
+static int	take_stage_timeout(t_command *cmd, char **envp, t_events *ev)
+{
+	long	limit;
+	int		skip;
+
+	skip = 1;
+	if (cmd->args_count > 2 && ft_strcmp(cmd->args[1], "-k") == 0)
+	{
+		if (timeout_operand(cmd->args[2], envp, &ev->grace_ms) == -1)
+			return (-1);
+		skip = 3;
+	}
+	if (cmd->args_count <= skip + 1)
+	{
+		ft_fprintf_fd(2, "minishell: timeout: missing operand\n");
+		return (-1);
+	}
+	if (timeout_operand(cmd->args[skip], envp, &limit) == -1)
+		return (-1);
+	if (limit > 0 && (ev->limit_ms == 0 || limit < ev->limit_ms))
+		ev->limit_ms = limit;
+	skip++;
+	while (skip-- > 0)
+		drop_first_word(cmd);
+	return (0);
+}
+
+/*
+ * The pipeline gets the shortest limit asked for by any of its stages
+ */
+int	take_pipeline_timeout(t_command *cmd_list, t_env *env_list)
+{
+	t_events	*ev;
+	char		**envp;
+	int			ret;
+
+	ev = shell_events();
+	ev->grace_ms = TIMEOUT_GRACE_MS;
+	envp = NULL;
+	ret = 0;
+	while (cmd_list && ret == 0)
+	{
+		if (cmd_list->args && cmd_list->args[0]
+			&& ft_strcmp(cmd_list->args[0], "timeout") == 0)
+		{
+			if (!envp)
+				envp = env_list_to_envp(env_list);
+			if (!envp)
+				return (-1);
+			ret = take_stage_timeout(cmd_list, envp, ev);
+		}
+		cmd_list = cmd_list->next;
+	}
+	safe_doube_star_free(envp);
+	if (ret == -1)
+		ev->limit_ms = 0;
+	return (ret);
+}
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   usage_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:52:53 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:52:53 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static char	*timeval_ms(struct timeval *tv)
+{
+	return (ft_itoa((int)(tv->tv_sec * 1000 + tv->tv_usec / 1000)));
+}
+
+/*
+ * With PIPELINE_STATS set, prints what the children reaped by the last
+ * wait used: user and system CPU time summed over them, and the largest
+ * resident set among them
+ */
+void	usage_report(t_env *env_list)
+{
+	t_events	*ev;
+	t_env		*node;
+	char		*num[3];
+
+	node = find_env_node(env_list, "PIPELINE_STATS");
+	if (!node || !node->value || !node->value[0])
+		return ;
+	ev = shell_events();
+	num[0] = timeval_ms(&ev->usage.ru_utime);
+	num[1] = timeval_ms(&ev->usage.ru_stime);
+	num[2] = ft_itoa((int)ev->usage.ru_maxrss);
+	if (num[0] && num[1] && num[2])
+		ft_fprintf_fd(2, "minishell: usage: user %s ms, sys %s ms, "
+			"max rss %s KiB\n", num[0], num[1], num[2]);
+	safe_free((void **)&num[0]);
+	safe_free((void **)&num[1]);
+	safe_free((void **)&num[2]);
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   user_fds.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:00:52 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 14:00:52 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Bit N is set while descriptor N was opened by `exec` and belongs to
+ * the user rather than to the shell
+ */
+unsigned int	*user_fds(void)
+{
+	static unsigned int	mask;
+
+	return (&mask);
+}
+
+static int	is_redirect_target(t_command *cmd, int fd)
+{
+	t_redirections	*redir;
+
+	redir = cmd->redirections;
+	while (redir)
+	{
+		if (redirect_target_fd(redir) == fd)
+			return (1);
+		redir = redir->next;
+	}
+	return (0);
+}
+
+/*
+ * Children keep the standard fds, the ones opened by `exec` and the ones
+ * their own redirections name. Everything else the shell holds is closed,
+ * as builtins never exec and would otherwise keep pipes open
+ */
+void	close_shell_fds(t_command *cmd)
+{
+	int	fd;
+
+	close_high_fds(cmd != NULL);
+	fd = STDERR_FILENO;
+	while (++fd < REDIRECT_FRAME_MIN_FD)
+	{
+		if ((*user_fds() & (1U << fd)) || (cmd && is_redirect_target(cmd, fd)))
+			continue ;
+		close(fd);
+	}
+}
+
+/*
+ * Shell descriptors created before a redirection is applied, like the
+ * heredoc pipes, are moved out of the range the user can name
+ */
+int	move_fd_high(int fd)
+{
+	int	high;
+
+	if (fd < 0 || fd >= REDIRECT_FRAME_MIN_FD)
+		return (fd);
+	high = fcntl(fd, F_DUPFD_CLOEXEC, REDIRECT_FRAME_MIN_FD);
+	if (high == -1)
+		return (fd);
+	close(fd);
+	return (high);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   zygote.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:29:14 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 10:29:14 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+t_zygote	*zygote(void)
+{
+	static t_zygote	z;
+
+	return (&z);
+}
+
+/*
+ * Called from main before the shell has read anything, so the helper's
+ * own fork and every clone() it does later copy a small address space
+ */
+int	zygote_start(void)
+{
+	t_zygote	*z;
+	int			sv[2];
+	pid_t		pid;
+
+	z = zygote();
+	if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) == -1)
+		return (-1);
+	pid = fork();
+	if (pid == -1)
+		return (close(sv[0]), close(sv[1]), -1);
+	if (pid == 0)
+	{
+		close(sv[0]);
+		zygote_serve(sv[1]);
+	}
+	close(sv[1]);
+	z->sock = move_fd_high(sv[0]);
+	z->pid = pid;
+	z->owner = getpid();
+	return (0);
+}
+
+/*
+ * The helper exits once its end of the socket reads end of file. A
+ * forked copy of the shell only drops its descriptor
+ */
+void	zygote_stop(void)
+{
+	t_zygote	*z;
+
+	z = zygote();
+	if (z->sock > 0)
+		close(z->sock);
+	if (z->pid > 0 && z->owner == getpid())
+		waitpid(z->pid, NULL, 0);
+	ft_bzero(z, sizeof(*z));
+}
+
+/*
+ * Plain external commands are handed to the zygote when there is one;
+ * anything else forks the shell. A subshell inherits the socket but
+ * not the helper, whose children would not be its own
+ */
+pid_t	spawn_stage(t_cmd_ctx *cmd_ctx)
+{
+	pid_t	pid;
+
+	pid = 0;
+	if (zygote()->sock > 0 && zygote()->owner == getpid())
+		pid = zygote_spawn(cmd_ctx);
+	if (pid > 0)
+		return (pid);
+	pid = fork();
+	if (pid == 0)
+		child_process(cmd_ctx);
+	return (pid);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   zygote_server.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:55:46 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:55:46 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Reads one request and the descriptors attached to it. Returns 0 at end
+ * of file or for anything the shell could not have sent, 1 otherwise
+ */
+static int	receive_request(int sock, t_zygote_req *req, int fds[ZYGOTE_FDS])
+{
+	struct iovec	iov;
+
+	iov.iov_base = req;
+	iov.iov_len = sizeof(*req);
+	if (fd_receive(sock, &iov, fds, ZYGOTE_FDS) <= 0)
+		return (0);
+	if (req->argc < 1 || req->envc < 0 || req->len > ZYGOTE_MAX_LEN)
+		return (0);
+	return (1);
+}
+
+/*
+ * Points words at the strings of the payload: the path, then argv and
+ * envp, each NULL-terminated. Fails if the count does not match
+ */
+static char	**unpack_words(char *data, t_zygote_req *req)
+{
+	char	**words;
+	size_t	off;
+	int		n;
+
+	if (req->len == 0 || data[req->len - 1] != '\0')
+		return (NULL);
+	words = malloc(sizeof(char *) * (req->argc + req->envc + 3));
+	if (!words)
+		return (NULL);
+	off = 0;
+	n = 0;
+	while (off < req->len && n < req->argc + req->envc + 1)
+	{
+		words[n + (n > req->argc)] = data + off;
+		off += ft_strlen(data + off) + 1;
+		n++;
+	}
+	words[req->argc + 1] = NULL;
+	words[req->argc + req->envc + 2] = NULL;
+	if (off != req->len || n != req->argc + req->envc + 1)
+		return (safe_free((void **)&words), NULL);
+	return (words);
+}
+
+static void	zygote_child(char **words, int argc, int fds[ZYGOTE_FDS])
+{
+	sigset_t	set;
+
+	if (dup2(fds[0], STDIN_FILENO) == -1 || dup2(fds[1], STDOUT_FILENO) == -1
+		|| dup2(fds[2], STDERR_FILENO) == -1 || fchdir(fds[3]) == -1)
+		_exit(1);
+	close_range(STDERR_FILENO + 1, ~0U, 0);
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	sigemptyset(&set);
+	sigprocmask(SIG_SETMASK, &set, NULL);
+	execve(words[0], words + 1, words + argc + 2);
+	perror("minishell: execve");
+	_exit(126);
+}
+
+/*
+ * The child is clone()d with CLONE_PARENT: it becomes the shell's child,
+ * with the same process group and terminal, and is reaped by the shell
+ */
+static void	spawn_request(int sock, t_zygote_req *req, int fds[ZYGOTE_FDS])
+{
+	char	*data;
+	char	**words;
+	pid_t	pid;
+	int		i;
+
+	pid = -1;
+	words = NULL;
+	data = malloc(req->len + 1);
+	if (!data || read_all(sock, data, req->len) == -1)
+		_exit(1);
+	words = unpack_words(data, req);
+	if (words)
+		pid = syscall(SYS_clone, CLONE_PARENT | SIGCHLD, 0, 0, 0, 0);
+	if (pid == 0)
+		zygote_child(words, req->argc, fds);
+	safe_free((void **)&words);
+	safe_free((void **)&data);
+	write_all(sock, (char *)&pid, sizeof(pid));
+	i = -1;
+	while (++i < ZYGOTE_FDS)
+		close(fds[i]);
+}
+
+/*
+ * The helper's main loop. It keeps nothing of the shell but the socket
+ * and ignores the terminal's SIGINT and SIGQUIT, which its children get
+ */
+void	zygote_serve(int sock)
+{
+	t_zygote_req	req;
+	int				fds[ZYGOTE_FDS];
+	int				i;
+
+	signal(SIGINT, SIG_IGN);
+	signal(SIGQUIT, SIG_IGN);
+	if (dup2(sock, STDERR_FILENO + 1) == -1)
+		_exit(1);
+	sock = STDERR_FILENO + 1;
+	i = open("/dev/null", O_RDWR);
+	if (i < 0)
+		_exit(1);
+	dup2(i, STDIN_FILENO);
+	dup2(i, STDOUT_FILENO);
+	dup2(i, STDERR_FILENO);
+	close_range(sock + 1, ~0U, 0);
+	while (receive_request(sock, &req, fds))
+		spawn_request(sock, &req, fds);
+	_exit(0);
+}
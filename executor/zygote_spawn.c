@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   zygote_spawn.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:10:44 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 19:10:44 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * The planned path of a plain external command, or NULL for anything
+ * the shell still forks for: builtins and groups (which have no path),
+ * redirections, fds the command must inherit, a timeout's process
+ * group, or a command that fails and needs its usual error message
+ */
+static char	*zygote_path(t_command *cmd, t_stage *stage)
+{
+	struct stat	st;
+
+	if (!stage || !stage->path || !stage->envp || cmd->redirections
+		|| procsubst_fds()->count || *user_fds()
+		|| shell_events()->pgid != 0)
+		return (NULL);
+	if (stat(stage->path, &st) == -1 || !S_ISREG(st.st_mode)
+		|| access(stage->path, X_OK) == -1)
+		return (NULL);
+	return (stage->path);
+}
+
+static int	pack_strings(t_subst_buf *buf, char **strs)
+{
+	size_t	len;
+	int		n;
+
+	n = 0;
+	while (strs && strs[n])
+	{
+		len = ft_strlen(strs[n]) + 1;
+		if (!subst_buf_reserve(buf, len))
+			return (-1);
+		ft_memcpy(buf->data + buf->len, strs[n++], len);
+		buf->len += len;
+	}
+	return (n);
+}
+
+/*
+ * The helper answers with the pid, or -1 when its clone() failed. A
+ * helper that stops answering is dropped and the shell goes back to
+ * forking
+ */
+static pid_t	send_stage(t_cmd_ctx *cmd_ctx, t_subst_buf *buf,
+		t_zygote_req *req)
+{
+	struct iovec	iov;
+	int				fds[ZYGOTE_FDS];
+	pid_t			pid;
+
+	iov.iov_base = req;
+	iov.iov_len = sizeof(*req);
+	fds[0] = STDIN_FILENO;
+	if (cmd_ctx->prev_pipe_read != -1)
+		fds[0] = cmd_ctx->prev_pipe_read;
+	fds[1] = STDOUT_FILENO;
+	if (cmd_ctx->pipe_fd[1] != -1)
+		fds[1] = cmd_ctx->pipe_fd[1];
+	fds[2] = STDERR_FILENO;
+	fds[3] = open(".", O_PATH | O_DIRECTORY | O_CLOEXEC);
+	pid = 0;
+	if (fds[3] >= 0 && fd_send(zygote()->sock, &iov, fds, ZYGOTE_FDS) == 0
+		&& send_all(zygote()->sock, buf->data, buf->len) == 0
+		&& read_all(zygote()->sock, (char *)&pid, sizeof(pid)) == 0)
+		return (close(fds[3]), pid);
+	if (fds[3] >= 0)
+		close(fds[3]);
+	zygote_stop();
+	return (0);
+}
+
+/*
+ * Returns the pid of the command the helper started, or 0 or -1 when the
+ * shell has to fork it itself
+ */
+pid_t	zygote_spawn(t_cmd_ctx *cmd_ctx)
+{
+	t_subst_buf		buf;
+	t_zygote_req	req;
+	char			*path[2];
+	pid_t			pid;
+
+	ft_bzero(&buf, sizeof(buf));
+	path[0] = zygote_path(cmd_ctx->current, cmd_ctx->stage);
+	path[1] = NULL;
+	pid = 0;
+	if (path[0] && pack_strings(&buf, path) == 1)
+	{
+		req.argc = pack_strings(&buf, cmd_ctx->current->args);
+		req.envc = pack_strings(&buf, cmd_ctx->stage->envp);
+		req.len = buf.len;
+		if (req.argc > 0 && req.envc >= 0 && req.len <= ZYGOTE_MAX_LEN)
+			pid = send_stage(cmd_ctx, &buf, &req);
+	}
+	safe_free((void **)&buf.data);
+	return (pid);
+}
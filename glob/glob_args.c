@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_args.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:26:07 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 19:26:07 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static void	glob_mark_word(char *s)
+{
+	char	quote;
+	int		i;
+
+	quote = 0;
+	i = -1;
+	while (s[++i])
+	{
+		if (!quote && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (quote && s[i] == quote)
+			quote = 0;
+		else if (quote)
+			continue ;
+		else if (s[i] == '$' && s[i + 1] == '?')
+			i++;
+		else if (s[i] == '$' && (s[i + 1] == '(' || s[i + 1] == '{')
+			&& subst_end(s, i) > 0)
+			i = subst_end(s, i) - 1;
+		else if (s[i] == '*')
+			s[i] = GLOB_STAR_MARK;
+		else if (s[i] == '?')
+			s[i] = GLOB_ANY_MARK;
+		else if (s[i] == '[')
+			s[i] = GLOB_CLASS_MARK;
+	}
+}
+
+void	glob_mark_args(t_command *cmd)
+{
+	int	i;
+
+	if (!cmd || !cmd->args)
+		return ;
+	i = 0;
+	while (i < cmd->args_count)
+	{
+		if (cmd->args[i])
+			glob_mark_word(cmd->args[i]);
+		i++;
+	}
+}
+
+static int	needs_globbing(t_command *cmd)
+{
+	int	i;
+
+	i = 0;
+	while (i < cmd->args_count)
+	{
+		if (has_glob_marks(cmd->args[i]))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+static void	move_arg(t_strvec *all, char **arg, int threads)
+{
+	int	matched;
+
+	matched = 0;
+	if (has_glob_marks(*arg))
+		matched = glob_expand_word(*arg, all, threads);
+	if (matched < 0 && *shell_interrupt())
+		*expansion_error() = 1;
+	if (matched > 0)
+		safe_free((void **)arg);
+	else
+	{
+		glob_unmark(*arg);
+		if (!strvec_push(all, *arg))
+			free(*arg);
+		*arg = NULL;
+	}
+}
+
+void	glob_expand_args(t_command *cmd, char **envp)
+{
+	t_strvec	all;
+	int			i;
+	int			threads;
+
+	if (!cmd || !cmd->args || !needs_globbing(cmd))
+		return ;
+	ft_bzero(&all, sizeof(t_strvec));
+	threads = glob_thread_count(envp);
+	i = 0;
+	while (i < cmd->args_count)
+		move_arg(&all, &cmd->args[i++], threads);
+	if (!all.items)
+		return ;
+	safe_free((void **)&cmd->args);
+	cmd->args = all.items;
+	cmd->args_count = all.count;
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:13:20 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 13:13:20 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static t_dir_cache	**glob_cache_head(void)
+{
+	static t_dir_cache	*head;
+
+	return (&head);
+}
+
+static int	read_dir_names(const char *dir, t_strvec *names)
+{
+	DIR				*dp;
+	struct dirent	*entry;
+
+	dp = opendir(dir);
+	if (!dp)
+		return (0);
+	entry = readdir(dp);
+	while (entry)
+	{
+		if (ft_strcmp(entry->d_name, ".") && ft_strcmp(entry->d_name, ".."))
+		{
+			if (!strvec_push(names, ft_strdup(entry->d_name)))
+				return (closedir(dp), 0);
+		}
+		entry = readdir(dp);
+	}
+	closedir(dp);
+	return (1);
+}
+
+static int	same_dir_version(t_dir_cache *node, struct stat *st)
+{
+	return (node->dev == st->st_dev && node->ino == st->st_ino
+		&& node->mtime.tv_sec == st->st_mtim.tv_sec
+		&& node->mtime.tv_nsec == st->st_mtim.tv_nsec);
+}
+
+t_strvec	*glob_cache_lookup(const char *dir)
+{
+	struct stat	st;
+	t_dir_cache	*node;
+
+	if (stat(dir, &st) == -1 || !S_ISDIR(st.st_mode))
+		return (NULL);
+	node = *glob_cache_head();
+	while (node && !same_dir_version(node, &st))
+		node = node->next;
+	if (node)
+		return (&node->names);
+	node = ft_calloc(1, sizeof(t_dir_cache));
+	if (!node)
+		return (NULL);
+	node->dev = st.st_dev;
+	node->ino = st.st_ino;
+	node->mtime = st.st_mtim;
+	if (!read_dir_names(dir, &node->names))
+		return (strvec_free(&node->names), safe_free((void **)&node), NULL);
+	node->next = *glob_cache_head();
+	*glob_cache_head() = node;
+	return (&node->names);
+}
+
+void	glob_cache_clear(void)
+{
+	t_dir_cache	*node;
+	t_dir_cache	*next;
+
+	node = *glob_cache_head();
+	while (node)
+	{
+		next = node->next;
+		strvec_free(&node->names);
+		safe_free((void **)&node);
+		node = next;
+	}
+	*glob_cache_head() = NULL;
+}
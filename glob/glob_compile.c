@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_compile.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:02:13 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:02:13 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static void	set_class_range(t_glob_node *node, unsigned char lo,
+		unsigned char hi)
+{
+	while (lo <= hi)
+	{
+		node->set[lo / 8] |= (unsigned char)(1 << (lo % 8));
+		if (lo == 255)
+			break ;
+		lo++;
+	}
+}
+
+/*
+ * s is the unmarked text of the pattern: inside [...], *, ? and [ are
+ * members of the set like any other character
+ */
+static int	parse_class(const char *s, int i, int end, t_glob_node *node)
+{
+	int	first;
+
+	ft_bzero(node, sizeof(t_glob_node));
+	node->op = GLOB_CLASS;
+	if (i < end && (s[i] == '!' || s[i] == '^'))
+		node->negate = (i++, 1);
+	first = i;
+	while (i < end && (s[i] != ']' || i == first))
+	{
+		if (i + 2 < end && s[i + 1] == '-' && s[i + 2] != ']')
+		{
+			set_class_range(node, s[i], s[i + 2]);
+			i += 3;
+		}
+		else
+		{
+			set_class_range(node, s[i], s[i]);
+			i++;
+		}
+	}
+	if (i >= end)
+		return (-1);
+	return (i + 1);
+}
+
+static int	compile_node(const char *s, int i, int end, t_glob_pat *pat)
+{
+	t_glob_node	*node;
+	int			next;
+
+	node = &pat->nodes[pat->count];
+	ft_bzero(node, sizeof(t_glob_node));
+	if (s[i] == GLOB_CLASS_MARK)
+	{
+		next = parse_class(pat->text, i + 1, end, node);
+		if (next > 0)
+			return (pat->count++, pat->has_magic = 1, next);
+		node->c = '[';
+	}
+	else if (s[i] == GLOB_STAR_MARK)
+	{
+		if (pat->count > 0 && pat->nodes[pat->count - 1].op == GLOB_STAR)
+			return (i + 1);
+		node->op = GLOB_STAR;
+	}
+	else if (s[i] == GLOB_ANY_MARK)
+		node->op = GLOB_ANY;
+	else
+		node->c = (unsigned char)s[i];
+	if (node->op != GLOB_CHAR)
+		pat->has_magic = 1;
+	return (pat->count++, i + 1);
+}
+
+int	glob_compile(const char *s, int len, t_glob_pat *pat)
+{
+	int	i;
+
+	ft_bzero(pat, sizeof(t_glob_pat));
+	pat->nodes = malloc(sizeof(t_glob_node) * (len + 1));
+	pat->text = ft_strndup(s, len);
+	if (!pat->nodes || !pat->text)
+		return (glob_pat_free(pat), 0);
+	glob_unmark(pat->text);
+	pat->globstar = (len == 2 && s[0] == GLOB_STAR_MARK
+			&& s[1] == GLOB_STAR_MARK);
+	i = 0;
+	while (i < len)
+		i = compile_node(s, i, len, pat);
+	pat->dot_ok = (pat->count > 0 && pat->nodes[0].op == GLOB_CHAR
+			&& pat->nodes[0].c == '.');
+	return (1);
+}
+
+void	glob_pat_free(t_glob_pat *pat)
+{
+	safe_free((void **)&pat->nodes);
+	safe_free((void **)&pat->text);
+	pat->count = 0;
+}
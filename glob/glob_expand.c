@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_expand.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:14:45 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 17:14:45 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+char	*glob_join(const char *base, const char *name)
+{
+	char	*path;
+	size_t	blen;
+	size_t	nlen;
+
+	if (!*base)
+		return (ft_strdup(name));
+	blen = ft_strlen(base);
+	if (base[blen - 1] == '/')
+		return (ft_strjoin(base, name));
+	nlen = ft_strlen(name);
+	path = malloc(blen + nlen + 2);
+	if (!path)
+		return (NULL);
+	ft_memcpy(path, base, blen);
+	path[blen] = '/';
+	ft_memcpy(path + blen + 1, name, nlen + 1);
+	return (path);
+}
+
+static void	glob_emit(t_glob_ctx *g, const char *path, int check)
+{
+	struct stat	st;
+
+	if (check && lstat(path, &st) == -1)
+		return ;
+	if (!strvec_push(g->out, ft_strdup(path)))
+		g->failed = 1;
+}
+
+static void	glob_walk_dir(t_glob_ctx *g, const char *base, int idx)
+{
+	t_strvec	*names;
+	char		*path;
+	int			i;
+
+	if (*base)
+		names = glob_cache_lookup(base);
+	else
+		names = glob_cache_lookup(".");
+	i = -1;
+	while (names && ++i < names->count && !g->failed)
+	{
+		if (names->items[i][0] == '.' && !g->pats[idx].dot_ok)
+			continue ;
+		if (!glob_match(&g->pats[idx], names->items[i]))
+			continue ;
+		path = glob_join(base, names->items[i]);
+		if (!path)
+		{
+			g->failed = 1;
+			return ;
+		}
+		glob_walk(g, path, idx + 1, 0);
+		free(path);
+	}
+}
+
+void	glob_walk(t_glob_ctx *g, const char *base, int idx, int check)
+{
+	char	*path;
+
+	if (idx == g->count)
+		return (glob_emit(g, base, check));
+	if (g->pats[idx].globstar)
+		return (glob_walk_globstar(g, base, idx, check));
+	if (g->pats[idx].has_magic)
+		return (glob_walk_dir(g, base, idx));
+	path = glob_join(base, g->pats[idx].text);
+	if (!path)
+	{
+		g->failed = 1;
+		return ;
+	}
+	glob_walk(g, path, idx + 1, 1);
+	free(path);
+}
+
+int	glob_expand_word(const char *word, t_strvec *out, int threads)
+{
+	t_glob_ctx	g;
+	int			start;
+
+	g.out = out;
+	g.failed = 0;
+	g.threads = threads;
+	g.count = glob_compile_word(word, &g.pats);
+	if (g.count < 0)
+		return (-1);
+	start = out->count;
+	if (word[0] == '/')
+		glob_walk(&g, "/", 0, 0);
+	else
+		glob_walk(&g, "", 0, 0);
+	glob_free_word(g.pats, g.count);
+	sort_strings(out->items + start, out->count - start);
+	if (g.failed)
+		return (-1);
+	return (out->count - start);
+}
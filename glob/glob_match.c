@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_match.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:24:58 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:24:58 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	node_matches(t_glob_node *node, unsigned char c)
+{
+	int	in_set;
+
+	if (node->op == GLOB_ANY)
+		return (1);
+	if (node->op == GLOB_CHAR)
+		return (node->c == c);
+	if (node->op == GLOB_CLASS)
+	{
+		in_set = (node->set[c / 8] >> (c % 8)) & 1;
+		return (in_set != node->negate);
+	}
+	return (0);
+}
+
+static int	only_stars_left(t_glob_pat *pat, int pi)
+{
+	while (pi < pat->count && pat->nodes[pi].op == GLOB_STAR)
+		pi++;
+	return (pi == pat->count);
+}
+
+int	glob_match_n(t_glob_pat *pat, const char *s, int len)
+{
+	int	pi;
+	int	si;
+	int	star_pi;
+	int	star_si;
+
+	pi = 0;
+	si = 0;
+	star_pi = -1;
+	star_si = 0;
+	while (si < len)
+	{
+		if (pi < pat->count && pat->nodes[pi].op == GLOB_STAR)
+		{
+			star_pi = pi++;
+			star_si = si;
+		}
+		else if (pi < pat->count && node_matches(&pat->nodes[pi], s[si]))
+			pi = (si++, pi + 1);
+		else if (star_pi >= 0)
+			pi = (si = ++star_si, star_pi + 1);
+		else
+			return (0);
+	}
+	return (only_stars_left(pat, pi));
+}
+
+int	glob_match(t_glob_pat *pat, const char *s)
+{
+	return (glob_match_n(pat, s, ft_strlen(s)));
+}
+
+void	glob_unmark(char *s)
+{
+	while (s && *s)
+	{
+		if (*s == GLOB_STAR_MARK)
+			*s = '*';
+		else if (*s == GLOB_ANY_MARK)
+			*s = '?';
+		else if (*s == GLOB_CLASS_MARK)
+			*s = '[';
+		s++;
+	}
+}
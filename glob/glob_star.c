@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_star.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:44:16 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:44:16 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+int	glob_thread_count(char **envp)
+{
+	char	*value;
+	long	count;
+
+	value = get_env_value("GLOBSTAR_THREADS", envp);
+	count = 0;
+	if (value && is_number(value))
+		count = ft_atoi(value);
+	safe_free((void **)&value);
+	if (count <= 0)
+		count = sysconf(_SC_NPROCESSORS_ONLN);
+	if (count > GLOBSTAR_MAX_THREADS)
+		count = GLOBSTAR_MAX_THREADS;
+	if (count < 1)
+		count = 1;
+	return ((int)count);
+}
+
+static int	open_star_root(const char *base)
+{
+	if (*base)
+		return (open(base, O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+	return (open(".", O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+}
+
+static void	walk_star_dirs(t_glob_ctx *g, t_star_pool *pool, int idx)
+{
+	t_strvec	dirs;
+	int			i;
+
+	ft_bzero(&dirs, sizeof(t_strvec));
+	pool->mode = STAR_EMIT_DIRS;
+	if (!strvec_push(&dirs, ft_strdup(pool->base))
+		|| star_pool_run(pool, g->threads, &dirs) == -1)
+	{
+		g->failed = 1;
+		return (strvec_free(&dirs));
+	}
+	sort_strings(dirs.items, dirs.count);
+	i = 0;
+	while (i < dirs.count && !g->failed)
+		glob_walk(g, dirs.items[i++], idx + 1, 0);
+	strvec_free(&dirs);
+}
+
+/*
+ * A trailing globstar also matches the directory it starts from. Like
+ * bash, a directory named in the word keeps its slash and one found by
+ * a pattern does not
+ */
+static void	emit_star_base(t_glob_ctx *g, const char *base, int literal)
+{
+	char	*path;
+
+	if (!*base)
+		return ;
+	if (literal)
+		path = glob_join(base, "");
+	else
+		path = ft_strdup(base);
+	if (!strvec_push(g->out, path))
+		g->failed = 1;
+}
+
+/*
+ * `**` matches zero or more directories. The traversal runs on a small
+ * work-stealing pool; when only one component follows, it is matched
+ * during the walk so every directory is read exactly once.
+ */
+void	glob_walk_globstar(t_glob_ctx *g, const char *base, int idx,
+		int literal)
+{
+	t_star_pool	pool;
+	int			tail;
+
+	ft_bzero(&pool, sizeof(t_star_pool));
+	pool.base = base;
+	pool.root_fd = open_star_root(base);
+	if (pool.root_fd == -1)
+		return ;
+	tail = g->count - idx - 1;
+	if (tail == 1 && g->pats[idx + 1].count > 0)
+	{
+		pool.mode = STAR_EMIT_LEAF;
+		pool.leaf = &g->pats[idx + 1];
+	}
+	else if (tail == 0)
+		pool.mode = STAR_EMIT_ALL;
+	if (tail == 0)
+		emit_star_base(g, base, literal);
+	if (tail != 0 && !pool.leaf)
+		walk_star_dirs(g, &pool, idx);
+	else if (star_pool_run(&pool, g->threads, g->out) == -1)
+		g->failed = 1;
+	close(pool.root_fd);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_star_idle.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:07:37 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 19:07:37 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+char	*star_next_task(t_star_worker *w)
+{
+	char	*task;
+	int		i;
+
+	task = star_queue_take(&w->queue, 0);
+	i = 1;
+	while (!task && i < w->pool->count)
+	{
+		task = star_queue_take(&w->pool->workers[(w->id + i)
+				% w->pool->count].queue, 1);
+		i++;
+	}
+	return (task);
+}
+
+/*
+ * The worker counts itself as sleeping before it looks at the queues one
+ * last time, so a push that it misses is one that sees it and wakes it
+ */
+char	*star_worker_park(t_star_worker *w)
+{
+	t_star_pool	*pool;
+	char		*task;
+	int			seen;
+
+	pool = w->pool;
+	__atomic_add_fetch(&pool->sleeping, 1, __ATOMIC_SEQ_CST);
+	seen = __atomic_load_n(&pool->wake_gen, __ATOMIC_SEQ_CST);
+	task = star_next_task(w);
+	if (!task)
+	{
+		pthread_mutex_lock(&pool->idle_lock);
+		while (pool->wake_gen == seen
+			&& __atomic_load_n(&pool->pending, __ATOMIC_SEQ_CST) > 0)
+			pthread_cond_wait(&pool->wake, &pool->idle_lock);
+		pthread_mutex_unlock(&pool->idle_lock);
+	}
+	__atomic_sub_fetch(&pool->sleeping, 1, __ATOMIC_SEQ_CST);
+	return (task);
+}
+
+void	star_pool_wake(t_star_pool *pool)
+{
+	pthread_mutex_lock(&pool->idle_lock);
+	__atomic_add_fetch(&pool->wake_gen, 1, __ATOMIC_SEQ_CST);
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->idle_lock);
+}
+
+/*
+ * Called after a push; costs one load while every worker is busy
+ */
+void	star_pool_notify(t_star_pool *pool)
+{
+	if (__atomic_load_n(&pool->sleeping, __ATOMIC_SEQ_CST) > 0)
+		star_pool_wake(pool);
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_star_pool.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:51:51 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:51:51 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * A worker that finds nothing yields a few times, since a sibling is
+ * usually about to push, then parks until there is work or the walk ends.
+ * After a Ctrl-C the remaining tasks are dropped unread
+ */
+static void	*star_worker_main(void *arg)
+{
+	t_star_worker	*w;
+	char			*task;
+	int				idle;
+
+	w = (t_star_worker *)arg;
+	idle = 0;
+	while (__atomic_load_n(&w->pool->pending, __ATOMIC_SEQ_CST) > 0)
+	{
+		task = star_next_task(w);
+		if (!task && idle < GLOBSTAR_SPINS)
+			sched_yield();
+		else if (!task)
+			task = star_worker_park(w);
+		idle++;
+		if (!task)
+			continue ;
+		idle = 0;
+		if (!shell_interrupted())
+			star_scan_dir(w, task);
+		free(task);
+		if (__atomic_sub_fetch(&w->pool->pending, 1, __ATOMIC_SEQ_CST) == 0)
+			star_pool_wake(w->pool);
+	}
+	return (NULL);
+}
+
+static int	star_pool_init(t_star_pool *pool, int count)
+{
+	int	i;
+
+	pool->workers = ft_calloc(count, sizeof(t_star_worker));
+	if (!pool->workers)
+		return (0);
+	pool->count = count;
+	i = -1;
+	while (++i < count)
+	{
+		pool->workers[i].pool = pool;
+		pool->workers[i].id = i;
+		pthread_mutex_init(&pool->workers[i].queue.lock, NULL);
+	}
+	pthread_mutex_init(&pool->idle_lock, NULL);
+	pthread_cond_init(&pool->wake, NULL);
+	pool->pending = 1;
+	return (star_queue_push(&pool->workers[0].queue, ft_strdup("")));
+}
+
+static void	star_pool_merge(t_star_pool *pool, t_strvec *out)
+{
+	t_star_worker	*w;
+	int				i;
+	int				j;
+
+	i = -1;
+	while (++i < pool->count)
+	{
+		w = &pool->workers[i];
+		j = 0;
+		while (j < w->results.count)
+		{
+			if (!pool->failed && strvec_push(out, w->results.items[j]))
+				w->results.items[j] = NULL;
+			j++;
+		}
+		strvec_free(&w->results);
+		star_queue_destroy(&w->queue);
+	}
+	safe_free((void **)&pool->workers);
+	pthread_mutex_destroy(&pool->idle_lock);
+	pthread_cond_destroy(&pool->wake);
+}
+
+/*
+ * Worker 0 runs on the calling thread; the others are started only for
+ * the duration of one traversal.
+ */
+int	star_pool_run(t_star_pool *pool, int count, t_strvec *out)
+{
+	int	i;
+	int	started;
+
+	if (!star_pool_init(pool, count))
+		return (safe_free((void **)&pool->workers), -1);
+	started = 1;
+	while (started < count && pthread_create(&pool->workers[started].thread,
+			NULL, star_worker_main, &pool->workers[started]) == 0)
+		started++;
+	star_worker_main(&pool->workers[0]);
+	i = 1;
+	while (i < started)
+		pthread_join(pool->workers[i++].thread, NULL);
+	pool->failed |= *shell_interrupt();
+	star_pool_merge(pool, out);
+	if (pool->failed)
+		return (-1);
+	return (0);
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_star_queue.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:03:23 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 14:03:23 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	star_queue_grow(t_star_queue *q)
+{
+	char	**items;
+	int		cap;
+	int		live;
+
+	live = q->tail - q->head;
+	cap = q->cap;
+	if (live * 2 >= cap)
+		cap = cap * 2 + 64;
+	items = malloc(sizeof(char *) * cap);
+	if (!items)
+		return (0);
+	if (live > 0)
+		ft_memcpy(items, q->items + q->head, sizeof(char *) * live);
+	safe_free((void **)&q->items);
+	q->items = items;
+	q->cap = cap;
+	q->head = 0;
+	q->tail = live;
+	return (1);
+}
+
+int	star_queue_push(t_star_queue *q, char *path)
+{
+	int	ok;
+
+	if (!path)
+		return (0);
+	pthread_mutex_lock(&q->lock);
+	ok = (q->tail < q->cap || star_queue_grow(q));
+	if (ok)
+		q->items[q->tail++] = path;
+	pthread_mutex_unlock(&q->lock);
+	if (!ok)
+		free(path);
+	return (ok);
+}
+
+/*
+ * The owner pops the newest task (depth-first, warm dentries); thieves
+ * take the oldest one, which tends to be the largest unexplored subtree.
+ */
+char	*star_queue_take(t_star_queue *q, int steal)
+{
+	char	*path;
+
+	path = NULL;
+	pthread_mutex_lock(&q->lock);
+	if (q->tail > q->head && steal)
+		path = q->items[q->head++];
+	else if (q->tail > q->head)
+		path = q->items[--q->tail];
+	pthread_mutex_unlock(&q->lock);
+	return (path);
+}
+
+void	star_queue_destroy(t_star_queue *q)
+{
+	while (q->tail > q->head)
+		safe_free((void **)&q->items[--q->tail]);
+	safe_free((void **)&q->items);
+	pthread_mutex_destroy(&q->lock);
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_star_scan.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:08:47 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 16:08:47 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	star_is_dir(int dirfd, t_dirent64 *ent)
+{
+	struct stat	st;
+
+	if (ent->d_type == DT_DIR)
+		return (1);
+	if (ent->d_type != DT_UNKNOWN)
+		return (0);
+	if (fstatat(dirfd, ent->d_name, &st, AT_SYMLINK_NOFOLLOW) == -1)
+		return (0);
+	return (S_ISDIR(st.st_mode));
+}
+
+static int	star_wants(t_star_pool *pool, const char *name, int is_dir)
+{
+	if (pool->mode == STAR_EMIT_ALL)
+		return (1);
+	if (pool->mode == STAR_EMIT_DIRS)
+		return (is_dir);
+	return (glob_match(pool->leaf, name));
+}
+
+static void	star_emit(t_star_worker *w, const char *rel)
+{
+	if (!strvec_push(&w->results, glob_join(w->pool->base, rel)))
+		__atomic_store_n(&w->pool->failed, 1, __ATOMIC_RELAXED);
+}
+
+static void	star_handle_entry(t_star_worker *w, const char *rel,
+		t_dirent64 *ent, int dirfd)
+{
+	char	*path;
+	int		is_dir;
+	int		hidden;
+
+	hidden = (ent->d_name[0] == '.');
+	if (hidden && (!ft_strcmp(ent->d_name, ".") || !ft_strcmp(ent->d_name,
+				"..") || !w->pool->leaf || !w->pool->leaf->dot_ok))
+		return ;
+	is_dir = star_is_dir(dirfd, ent);
+	path = glob_join(rel, ent->d_name);
+	if (!path)
+		return (__atomic_store_n(&w->pool->failed, 1, __ATOMIC_RELAXED));
+	if (star_wants(w->pool, ent->d_name, is_dir))
+		star_emit(w, path);
+	if (is_dir && !hidden)
+	{
+		__atomic_add_fetch(&w->pool->pending, 1, __ATOMIC_SEQ_CST);
+		if (star_queue_push(&w->queue, path))
+			return (star_pool_notify(w->pool));
+		__atomic_sub_fetch(&w->pool->pending, 1, __ATOMIC_SEQ_CST);
+		return (__atomic_store_n(&w->pool->failed, 1, __ATOMIC_RELAXED));
+	}
+	free(path);
+}
+
+void	star_scan_dir(t_star_worker *w, const char *rel)
+{
+	long		buf[4096];
+	int			fd;
+	long		n;
+	long		off;
+	t_dirent64	*ent;
+
+	if (*rel)
+		fd = openat(w->pool->root_fd, rel, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	else
+		fd = openat(w->pool->root_fd, ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fd == -1)
+		return ;
+	n = syscall(SYS_getdents64, fd, buf, sizeof(buf));
+	while (n > 0)
+	{
+		off = 0;
+		while (off < n)
+		{
+			ent = (t_dirent64 *)((char *)buf + off);
+			star_handle_entry(w, rel, ent, fd);
+			off += ent->d_reclen;
+		}
+		n = syscall(SYS_getdents64, fd, buf, sizeof(buf));
+	}
+	close(fd);
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_word.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:12:16 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 16:12:16 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	count_components(const char *word)
+{
+	int	count;
+
+	count = 1;
+	while (*word)
+		count += (*word++ == '/');
+	return (count);
+}
+
+int	glob_compile_word(const char *word, t_glob_pat **pats)
+{
+	int	count;
+	int	i;
+	int	start;
+
+	while (*word == '/')
+		word++;
+	*pats = ft_calloc(count_components(word), sizeof(t_glob_pat));
+	if (!*pats)
+		return (-1);
+	count = 0;
+	start = 0;
+	i = 0;
+	while (1)
+	{
+		if (word[i] == '/' || word[i] == '\0')
+		{
+			if (!glob_compile(word + start, i - start, &(*pats)[count++]))
+				return (glob_free_word(*pats, count), -1);
+			if (word[i] == '\0')
+				break ;
+			start = i + 1;
+		}
+		i++;
+	}
+	return (count);
+}
+
+void	glob_free_word(t_glob_pat *pats, int count)
+{
+	int	i;
+
+	i = 0;
+	while (pats && i < count)
+		glob_pat_free(&pats[i++]);
+	safe_free((void **)&pats);
+}
+
+int	has_glob_marks(const char *s)
+{
+	while (s && *s)
+	{
+		if (*s == GLOB_STAR_MARK || *s == GLOB_ANY_MARK
+			|| *s == GLOB_CLASS_MARK)
+			return (1);
+		s++;
+	}
+	return (0);
+}
+
+/*
+ * The inverse of glob_unmark, for unquoted expansion results
+ */
+void	glob_mark(char *s)
+{
+	while (s && *s)
+	{
+		if (*s == '*')
+			*s = GLOB_STAR_MARK;
+		else if (*s == '?')
+			*s = GLOB_ANY_MARK;
+		else if (*s == '[')
+			*s = GLOB_CLASS_MARK;
+		s++;
+	}
+}
@@ -14,27 +14,23 @@
 
 int			g_last_exit_status = 0;
 
-static int	process_command(char *input, t_env **env_list)
+int	process_command(char *input, t_env **env_list)
 {
 	t_token		*tokens;
-	t_command	*cmds;
+	t_sequence	*seq;
 
-	tokens = NULL;
-	cmds = NULL;
+	*shell_interrupt() = 0;
 	tokens = tokenize_input(input);
 	if (!tokens)
 		return (0);
 	assign_token_types(tokens);
-	cmds = create_cmds(&tokens);
-	if (cmds)
+	seq = parse_command_line(tokens);
+	ft_token_clear(&tokens, free);
+	if (seq)
 	{
-		ft_token_clear(&tokens, free);
-		g_last_exit_status = execute_command_list(cmds, env_list);
-		free_command_list(cmds);
-	}
-	else if (tokens)
-	{
-		ft_token_clear(&tokens, free);
+		execute_sequence(seq, env_list);
+		free_sequence(seq);
+		glob_cache_clear();
 	}
 	return (0);
 }
@@ -48,7 +44,7 @@ static void	shell_loop(t_env **env_list)
 	should_exit = 0;
 	while (!should_exit)
 	{
-		input = readline("minishell> ");
+		input = read_prompt_line("minishell> ");
 		if (input == NULL)
 		{
 			printf("exit\n");
@@ -71,16 +67,19 @@ int	main(int argc, char **argv, char **envp)
 {
 	t_env	*env_list;
 
-	(void)argc;
-	(void)argv;
-	signal(SIGINT, sigint_handler);
-	signal(SIGQUIT, SIG_IGN);
+	if (argc > 1 && ft_strcmp(argv[1], "--zygote") == 0)
+		zygote_start();
 	env_list = envp_to_env_list(envp);
 	if (!env_list)
 		initialize_empty_env(&env_list);
 	else
 		update_shlvl(&env_list);
+	if (argc > 2 && ft_strcmp(argv[1], "--server") == 0)
+		return (server_run(argv[2], &env_list));
+	signals_init();
 	shell_loop(&env_list);
 	free_env_list(&env_list);
+	arith_cache_clear();
+	zygote_stop();
 	return (0);
 }
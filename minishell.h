@@ -13,20 +13,35 @@
 #ifndef MINISHELL_H
 # define MINISHELL_H
 
+# define _GNU_SOURCE
+
 # include "libft/libft.h"
 # include <dirent.h>
 # include <errno.h>
 # include <fcntl.h>
 # include <limits.h>
+# include <poll.h>
+# include <pthread.h>
 # include <readline/history.h>
 # include <readline/readline.h>
+# include <sched.h>
 # include <signal.h>
 # include <stdarg.h>
 # include <stdio.h>
 # include <stdlib.h>
 # include <string.h>
+# include <sys/epoll.h>
+# include <sys/mman.h>
+# include <sys/resource.h>
+# include <sys/sendfile.h>
+# include <sys/signalfd.h>
+# include <sys/socket.h>
 # include <sys/stat.h>
+# include <sys/syscall.h>
+# include <sys/time.h>
+# include <sys/timerfd.h>
 # include <sys/types.h>
+# include <sys/un.h>
 # include <sys/wait.h>
 # include <termios.h>
 # include <unistd.h>
@@ -53,7 +68,15 @@ typedef enum e_token_type
 	TOKEN_REDIRECT_OUT,
 	TOKEN_REDIRECT_IN,
 	TOKEN_APPEND,
-	TOKEN_HEREDOC
+	TOKEN_HEREDOC,
+	TOKEN_HERESTRING,
+	TOKEN_DUP_OUT,
+	TOKEN_DUP_IN,
+	TOKEN_SEMI,
+	TOKEN_LPAREN,
+	TOKEN_RPAREN,
+	TOKEN_LBRACE,
+	TOKEN_RBRACE
 }							t_token_type;
 
 /**
@@ -63,6 +86,7 @@ typedef struct s_token
 {
 	char					*content;
 	t_token_type			type;
+	int						io_number;
 	struct s_token			*next;
 }							t_token;
 
@@ -74,22 +98,46 @@ typedef struct s_redirections
 	t_token_type			type;
 	char					*file;
 	int						heredoc_fd;
+	int						fd;
+	int						fanout;
 	int						was_in_squotes;
 	int						was_in_dquotes;
 	struct s_redirections	*next;
 }							t_redirections;
 
 /**
- * Command structure representing a single command or pipeline element
+ * How a `{ ...; }` or `( ... )` stage runs its body
+ */
+typedef enum e_group_kind
+{
+	GROUP_NONE,
+	GROUP_BRACE,
+	GROUP_SUBSHELL
+}							t_group_kind;
+
+/**
+ * Command structure representing a single command or pipeline element.
+ * A group stage has no args and runs the commands in group instead
  */
 typedef struct s_command
 {
 	char					**args;
 	int						args_count;
 	t_redirections			*redirections;
+	struct s_sequence		*group;
+	t_group_kind			group_kind;
 	struct s_command		*next;
 }							t_command;
 
+/**
+ * Pipelines separated by `;`, run one after the other
+ */
+typedef struct s_sequence
+{
+	t_command				*pipeline;
+	struct s_sequence		*next;
+}							t_sequence;
+
 /**
  * Environment variable linked list structure
  */
@@ -116,6 +164,7 @@ int							ft_strcmp(const char *s1, const char *s2);
 int							ft_fprintf_fd(int fd, const char *format, ...);
 char						*strip_quotes(const char *value);
 int							is_content_quoted(char *content);
+int							find_unquoted(const char *s, char c);
 
 /* ===================== TOKENIZER ===================== */
 typedef struct s_tokenizer
@@ -148,7 +197,10 @@ typedef struct s_strip_ctx
 t_token						*tokenize_input(char *input);
 void						assign_token_types(t_token *tokens);
 int							is_operator(char c);
-char						*extract_operator_token(char *str, int *pos);
+char						*extract_operator_token(char *str, int *pos,
+								int start);
+int							is_redirect_token(t_token_type type);
+int							is_io_number(t_tokenizer *t);
 char						*extract_word_token(char *str, int start, int end);
 int							process_normal_char(t_tokenizer *t);
 int							process_operator(t_tokenizer *t);
@@ -176,6 +228,11 @@ typedef struct s_cmd_ctx
 	t_command				*current;
 	int						init_result;
 	t_env					**env_list;
+	struct s_fanout			*fanouts;
+	t_command				*deferred;
+	int						deferred_fd[2];
+	int						deferred_status;
+	struct s_stage			*stage;
 }							t_cmd_ctx;
 
 t_command					*create_cmds(t_token **tokens);
@@ -185,16 +242,20 @@ char						*find_executable_path(char *cmd, char **envp);
 int							setup_redirections(t_command *cmd);
 int							setup_heredoc(char *delimiter, char **envp);
 void						execute_single_command(t_cmd_ctx *cmd_ctx);
+void						handle_external_command(t_cmd_ctx *cmd_ctx);
 t_command					*create_command_type_word(t_token **tokens);
 t_command					*command_init(void);
-int							setup_redirect_in(char *file_path,
-								int was_in_squotes, int was_in_dquotes);
-int							setup_redirect_out(char *file_path, int append_mode,
-								int was_in_squotes, int was_in_dquotes);
+int							setup_redirect_in(t_redirections *redir);
+int							open_redirect_out(t_redirections *redir);
+int							setup_redirect_out(t_redirections *redir);
+int							setup_redirect_dup(t_redirections *redir);
+int							redirect_target_fd(t_redirections *redir);
+int							redirect_fd_in_range(t_redirections *redir);
 int							handle_redirect_token(t_token **current,
 								t_command **first_cmd, t_command **current_cmd);
 void						add_redirection(t_command *cmd,
-								t_token_type redirect_type, char *file);
+								t_token_type redirect_type, char *file,
+								int io_number);
 t_command					*finish_command_parsing(t_command *first_cmd);
 /* Command redirection utilities */
 int							count_word_tokens(t_token *current);
@@ -216,19 +277,17 @@ typedef struct s_env_setup
 	int						j;
 }							t_env_setup;
 
-int							is_builtin_command(char *cmd);
 int							execute_builtin(t_cmd_ctx *cmd_ctx);
-int							builtin_cd(t_command *cmd, t_env **env);
-int							builtin_echo(t_command *cmd);
-int							builtin_pwd(t_env **env);
-int							builtin_export(t_command *cmd, t_env **env_list);
-int							builtin_unset(t_command *cmd, t_env **env_list);
-int							builtin_env(t_command *cmd, t_env *env_list);
+int							builtin_cd(t_cmd_ctx *cmd_ctx);
+int							builtin_echo(t_cmd_ctx *cmd_ctx);
+int							builtin_pwd(t_cmd_ctx *cmd_ctx);
+int							builtin_export(t_cmd_ctx *cmd_ctx);
+int							builtin_unset(t_cmd_ctx *cmd_ctx);
+int							builtin_env(t_cmd_ctx *cmd_ctx);
 int							builtin_exit(t_cmd_ctx *cmd_ctx);
 int							export_one_arg(char *arg, t_env **env_list);
 void						unset_one_arg(char *arg, t_env **env_list);
 void						print_environment(t_env *env_list, t_command *cmd);
-int							is_parent_builtin(char *cmd);
 int							execute_single_parent_builtin(t_cmd_ctx *cmd_ctx);
 
 /* ===================== ENV LINKED LIST HELPERS ===================== */
@@ -241,10 +300,26 @@ char						**env_list_to_envp(t_env *env_list);
 int							is_valid_identifier(char *str);
 
 /* ===================== SIGNALS ===================== */
-void						heredoc_sigint_handler(int sig);
-void						sigint_handler(int sig);
+
+/**
+ * The line readline's callback hands back, once it has one
+ */
+typedef struct s_prompt
+{
+	char					*line;
+	int						done;
+}							t_prompt;
+
 void						ctrl_d_handle(void);
 void						child_sigint_handler(int sig);
+void						shell_sigmask(sigset_t *set);
+void						signals_init(void);
+void						reset_child_signals(void);
+char						*read_prompt_line(const char *prompt);
+int							*shell_interrupt(void);
+int							shell_interrupted(void);
+int							wait_readable(int fd);
+
 /* ===================== ENV EXPANSION UTILS ===================== */
 
 typedef struct s_var_expand
@@ -254,6 +329,8 @@ typedef struct s_var_expand
 	int						handle_ret;
 	int						is_empty_var;
 	int						has_quoted_vars;
+	int						mark_globs;
+	char					quote;
 }							t_var_expand;
 
 int							is_var_char(char c);
@@ -262,7 +339,10 @@ char						*get_env_value(char *var_name, char **envp);
 int							add_char_to_result(char **result, char c);
 void						update_quote_state(char c, t_state *state);
 char						*expand_variables(char *str, char **envp);
-void						expand_command_args(t_command *cmd, char **envp);
+char						*expand_variables_marked(char *str, char **envp,
+								int mark_globs);
+int							expand_command_args(t_command *cmd, char **envp);
+int							*expansion_error(void);
 
 /* ===================== ENV EXPANSION ARGS UTILS ===================== */
 typedef struct s_expand_vars
@@ -298,17 +378,927 @@ void						handle_fork_error(t_cmd_ctx *cmd_ctx);
 void						handle_child_input(t_cmd_ctx *cmd_ctx);
 void						handle_child_output(t_cmd_ctx *cmd_ctx);
 
+/* ===================== EXECUTOR STAGE ===================== */
+# define STAGE_SKIPPED -2
+# define HEREDOC_INTERRUPTED -2
+# define PIPESIZE_DEFAULT_MAX 1048576
+# define HERESTRING_PIPE_MAX PIPE_BUF
+# define STAGE_IN_SHELL -3
+
+int							setup_command_pipe(t_cmd_ctx *cmd_ctx);
+pid_t						skip_failed_stage(t_cmd_ctx *cmd_ctx);
+int							prepare_herestrings(t_command *cmd);
+void						apply_pipe_size(int fd, t_env *env_list);
+int							can_run_in_shell(t_cmd_ctx *cmd_ctx);
+pid_t						defer_stage(t_cmd_ctx *cmd_ctx);
+void						run_deferred_stage(t_cmd_ctx *cmd_ctx);
+
 /* ===================== EXECUTOR CHILD ===================== */
 void						child_process(t_cmd_ctx *cmd_ctx);
-int							wait_for_specific_pid(pid_t last_pid);
 int							parent_process(int prev_pipe_read, int pipe_fd[2]);
 int							setup_all_heredocs(t_command *cmd_list,
 								char **envp);
 /* ===================== UTILITY FUNCTIONS ===================== */
 void						print_Cmd_list(t_command *cmd);
+int							process_command(char *input, t_env **env_list);
 void						initialize_empty_env(t_env **env_list);
 void						update_shlvl(t_env **env_list);
 
 int							is_path_with_slash(char *cmd);
+int							write_all(int fd, const char *s, size_t len);
+int							send_all(int sock, const char *s, size_t len);
+int							read_all(int fd, char *s, size_t len);
 char						*check_direct_path(char *cmd);
+
+/* ===================== STRING VECTOR ===================== */
+typedef struct s_strvec
+{
+	char					**items;
+	int						count;
+	int						cap;
+}							t_strvec;
+
+int							strvec_push(t_strvec *v, char *s);
+void						strvec_free(t_strvec *v);
+void						sort_strings(char **arr, int n);
+
+/* ===================== GLOB ===================== */
+# define GLOB_STAR_MARK '\001'
+# define GLOB_ANY_MARK '\002'
+# define GLOB_CLASS_MARK '\003'
+
+typedef enum e_glob_op
+{
+	GLOB_CHAR,
+	GLOB_ANY,
+	GLOB_STAR,
+	GLOB_CLASS
+}							t_glob_op;
+
+typedef struct s_glob_node
+{
+	t_glob_op				op;
+	unsigned char			c;
+	int						negate;
+	unsigned char			set[32];
+}							t_glob_node;
+
+/**
+ * One compiled path component; literal components keep their text so the
+ * walker can join them without listing the directory
+ */
+typedef struct s_glob_pat
+{
+	t_glob_node				*nodes;
+	int						count;
+	int						has_magic;
+	int						dot_ok;
+	int						globstar;
+	char					*text;
+}							t_glob_pat;
+
+/**
+ * readdir() results cached for one command line, keyed by the directory
+ * identity and mtime so a changed directory is listed again
+ */
+typedef struct s_dir_cache
+{
+	dev_t					dev;
+	ino_t					ino;
+	struct timespec			mtime;
+	t_strvec				names;
+	struct s_dir_cache		*next;
+}							t_dir_cache;
+
+typedef struct s_glob_ctx
+{
+	t_glob_pat				*pats;
+	int						count;
+	t_strvec				*out;
+	int						threads;
+	int						failed;
+}							t_glob_ctx;
+
+int							glob_compile(const char *s, int len,
+								t_glob_pat *pat);
+void						glob_pat_free(t_glob_pat *pat);
+int							glob_match(t_glob_pat *pat, const char *s);
+int							glob_match_n(t_glob_pat *pat, const char *s,
+								int len);
+void						glob_unmark(char *s);
+void						glob_mark(char *s);
+int							has_glob_marks(const char *s);
+int							glob_compile_word(const char *word,
+								t_glob_pat **pats);
+void						glob_free_word(t_glob_pat *pats, int count);
+t_strvec					*glob_cache_lookup(const char *dir);
+void						glob_cache_clear(void);
+void						glob_walk(t_glob_ctx *g, const char *base, int idx,
+								int check);
+int							glob_expand_word(const char *word, t_strvec *out,
+								int threads);
+char						*glob_join(const char *base, const char *name);
+void						glob_mark_args(t_command *cmd);
+void						glob_expand_args(t_command *cmd, char **envp);
+
+/* ===================== GLOBSTAR ===================== */
+# define GLOBSTAR_MAX_THREADS 8
+# define GLOBSTAR_SPINS 16
+
+typedef enum e_star_mode
+{
+	STAR_EMIT_ALL,
+	STAR_EMIT_LEAF,
+	STAR_EMIT_DIRS
+}							t_star_mode;
+
+/**
+ * Raw getdents64 record
+ */
+typedef struct s_dirent64
+{
+	uint64_t				d_ino;
+	int64_t					d_off;
+	unsigned short			d_reclen;
+	unsigned char			d_type;
+	char					d_name[];
+}							t_dirent64;
+
+typedef struct s_star_queue
+{
+	pthread_mutex_t			lock;
+	char					**items;
+	int						head;
+	int						tail;
+	int						cap;
+}							t_star_queue;
+
+typedef struct s_star_worker
+{
+	struct s_star_pool		*pool;
+	int						id;
+	pthread_t				thread;
+	t_star_queue			queue;
+	t_strvec				results;
+}							t_star_worker;
+
+/**
+ * Shared state of one `**` traversal: directories are opened with openat()
+ * relative to root_fd and reported relative to base
+ */
+typedef struct s_star_pool
+{
+	t_star_worker			*workers;
+	int						count;
+	int						root_fd;
+	const char				*base;
+	t_star_mode				mode;
+	t_glob_pat				*leaf;
+	int						pending;
+	int						failed;
+	pthread_mutex_t			idle_lock;
+	pthread_cond_t			wake;
+	int						sleeping;
+	int						wake_gen;
+}							t_star_pool;
+
+int							glob_thread_count(char **envp);
+void						glob_walk_globstar(t_glob_ctx *g, const char *base,
+								int idx, int literal);
+int							star_pool_run(t_star_pool *pool, int count,
+								t_strvec *out);
+void						star_scan_dir(t_star_worker *w, const char *rel);
+char						*star_next_task(t_star_worker *w);
+char						*star_worker_park(t_star_worker *w);
+void						star_pool_wake(t_star_pool *pool);
+void						star_pool_notify(t_star_pool *pool);
+int							star_queue_push(t_star_queue *q, char *path);
+char						*star_queue_take(t_star_queue *q, int steal);
+void						star_queue_destroy(t_star_queue *q);
+
+/* ===================== BRACE EXPANSION ===================== */
+# define BRACE_ITEM_MAX 64
+# define BRACE_RANGE_MAX 214748364
+# define BRACE_ARG_MAX 131072
+# define BRACE_BUILTIN_FACTOR 32
+
+typedef enum e_brace_kind
+{
+	BRACE_NONE,
+	BRACE_LIST,
+	BRACE_RANGE
+}							t_brace_kind;
+
+typedef struct s_brace_range
+{
+	long					start;
+	long					end;
+	long					step;
+	long					count;
+	int						width;
+	int						is_char;
+}							t_brace_range;
+
+/**
+ * First expandable `{...}` of a word; `simple` is set when neither the
+ * preamble nor the postscript can hold another one
+ */
+typedef struct s_brace
+{
+	int						open;
+	int						close;
+	t_brace_kind			kind;
+	int						simple;
+	t_brace_range			range;
+}							t_brace;
+
+typedef struct s_brace_part
+{
+	char					*text;
+	size_t					len;
+}							t_brace_part;
+
+/**
+ * Without `out` the walk only counts words and argv bytes against `limit`
+ */
+typedef struct s_brace_ctx
+{
+	char					**out;
+	long					count;
+	long					bytes;
+	long					limit;
+	int						failed;
+}							t_brace_ctx;
+
+int							match_brace(const char *s, int open);
+int							next_brace_comma(const char *s, int i, int close);
+int							find_brace(const char *s, t_brace *br);
+int							parse_brace_range(const char *s, t_brace *br);
+int							format_brace_item(t_brace_range *r, long n,
+								char *buf);
+void						brace_walk(t_brace_ctx *b, char *word, int owned);
+void						brace_expand_args(t_command *cmd);
+
+/* ===================== ARITHMETIC ===================== */
+
+# define ARITH_CACHE_SLOTS 64
+# define ARITH_MAX_DEPTH 32
+# define ARITH_PAIR_OPS "**<<>><=>===!=&&||"
+# define ARITH_SINGLE_OPS "+-*/%<>&|^!~?:()"
+
+/**
+ * Two-character operators follow ARITH_PAIR_OPS and single ones
+ * ARITH_SINGLE_OPS, so the lexer maps a match straight to its value
+ */
+typedef enum e_arith_op
+{
+	ARITH_END,
+	ARITH_NUM,
+	ARITH_VAR,
+	ARITH_POW,
+	ARITH_SHL,
+	ARITH_SHR,
+	ARITH_LE,
+	ARITH_GE,
+	ARITH_EQ,
+	ARITH_NE,
+	ARITH_LAND,
+	ARITH_LOR,
+	ARITH_ADD,
+	ARITH_SUB,
+	ARITH_MUL,
+	ARITH_DIV,
+	ARITH_MOD,
+	ARITH_LT,
+	ARITH_GT,
+	ARITH_BAND,
+	ARITH_BOR,
+	ARITH_XOR,
+	ARITH_NOT,
+	ARITH_BNOT,
+	ARITH_QUEST,
+	ARITH_COLON,
+	ARITH_LPAREN,
+	ARITH_RPAREN,
+	ARITH_NEG,
+	ARITH_PLUS,
+	ARITH_TERNARY
+}							t_arith_op;
+
+typedef struct s_arith_tok
+{
+	t_arith_op				op;
+	long long				value;
+	char					*name;
+}							t_arith_tok;
+
+/**
+ * Operands are indexes into the owning expression's node array;
+ * `rhs` is -1 for unary nodes and `cond` is only used by ternaries
+ */
+typedef struct s_arith_node
+{
+	t_arith_op				op;
+	int						lhs;
+	int						rhs;
+	int						cond;
+	long long				value;
+	char					*name;
+}							t_arith_node;
+
+typedef struct s_arith_expr
+{
+	char					*text;
+	t_arith_node			*nodes;
+	int						count;
+	int						root;
+}							t_arith_expr;
+
+typedef struct s_arith_parser
+{
+	t_arith_tok				*toks;
+	int						pos;
+	t_arith_expr			*expr;
+	int						error;
+}							t_arith_parser;
+
+typedef struct s_arith_ctx
+{
+	t_arith_expr			*expr;
+	char					**envp;
+	int						depth;
+	const char				*error;
+}							t_arith_ctx;
+
+int							arith_lex(const char *s, t_arith_tok **toks);
+int							arith_node(t_arith_parser *p, t_arith_op op,
+								int lhs, int rhs);
+int							arith_parse_power(t_arith_parser *p);
+int							arith_binary_level(t_arith_op op);
+int							arith_parse_expr(t_arith_parser *p);
+void						arith_toks_free(t_arith_tok *toks);
+void						arith_expr_free(t_arith_expr *expr);
+t_arith_expr				*arith_compile(const char *text);
+long long					arith_eval_node(t_arith_ctx *c, int idx);
+t_arith_expr				*arith_cache_lookup(const char *text);
+void						arith_cache_clear(void);
+long long					arith_pow(t_arith_ctx *c, long long base,
+								long long exponent);
+const char					*arith_evaluate(const char *text, char **envp,
+								int depth, long long *out);
+int							expand_arith(t_var_expand *var_exp, char *str,
+								char **envp);
+
+/* ===================== COMMAND SUBSTITUTION ===================== */
+
+# define SUBST_BUF_MIN 4096
+
+typedef struct s_subst_buf
+{
+	char					*data;
+	size_t					len;
+	size_t					cap;
+}							t_subst_buf;
+
+int							subst_end(const char *s, int i);
+int							skip_quoted_text(const char *s, int i);
+int							subst_buf_reserve(t_subst_buf *buf, size_t want);
+int							subst_read_fd(int fd, t_subst_buf *buf);
+void						fold_field_separators(char *s);
+char						*subst_redirect_target(char *text, char **envp);
+int							expand_subst(t_var_expand *var_exp, char *str,
+								char **envp);
+int							subst_run_builtin(char *text, char **envp,
+								t_subst_buf *out);
+void						subst_run_child(char *text, char **envp,
+								t_subst_buf *out);
+
+/* ===================== PARAMETER EXPANSION ===================== */
+
+/**
+ * One `${...}`: `op` holds the operator without its `:` (set in
+ * `colon`), `word2` the replacement of `/` or the length of `:off:len`
+ */
+typedef struct s_param
+{
+	char					*name;
+	char					op[3];
+	int						colon;
+	int						length;
+	char					*word;
+	char					*word2;
+	char					*value;
+	char					**envp;
+}							t_param;
+
+int							param_parse(const char *body, t_param *p);
+void						param_free(t_param *p);
+char						*param_expand_word(const char *word, char **envp);
+char						*param_word_op(t_param *p);
+char						*param_substring(t_param *p);
+int							param_compile_pattern(const char *word, char **envp,
+								t_glob_pat *pat);
+char						*param_remove(t_param *p);
+char						*param_replace(t_param *p);
+t_strvec					*param_assignments(void);
+void						param_assign(const char *name, const char *value);
+char						*param_lookup(const char *name, char **envp);
+int							param_apply_assignments(t_env **env_list);
+void						param_drop_assignments(int keep);
+int							expand_param(t_var_expand *var_exp, char *str,
+								char **envp);
+
+/* ===================== CAT BUILTIN ===================== */
+# define CAT_CHUNK 131072
+# define CAT_RANGE 0
+# define CAT_SENDFILE 1
+# define CAT_SPLICE 2
+# define CAT_UNSUPPORTED -2
+
+int							run_builtin_cat(t_cmd_ctx *cmd_ctx);
+int							builtin_cat(t_command *cmd);
+int							cat_copy(int in, int out);
+
+/* ===================== REDIRECT FRAME ===================== */
+# define REDIRECT_FRAME_MIN_FD 10
+# define REDIRECT_FRAME_UNUSED -2
+
+typedef struct s_redirect_frame
+{
+	int						saved[REDIRECT_FRAME_MIN_FD];
+}							t_redirect_frame;
+
+int							redirect_frame_save(t_redirect_frame *frame,
+								t_command *cmd);
+void						redirect_frame_restore(t_redirect_frame *frame);
+void						redirect_frame_commit(t_redirect_frame *frame);
+int							redirect_frame_apply(t_redirect_frame *frame,
+								t_command *cmd);
+
+/* ===================== USER FDS ===================== */
+unsigned int				*user_fds(void);
+void						close_shell_fds(t_command *cmd);
+int							move_fd_high(int fd);
+int							builtin_exec(t_cmd_ctx *cmd_ctx);
+void						drop_first_word(t_command *cmd);
+
+/* ===================== FAN-OUT ===================== */
+# define FANOUT_NONE 0
+# define FANOUT_LEAD 1
+# define FANOUT_MEMBER 2
+# define FANOUT_CHUNK 65536
+
+/**
+ * Copies everything written into src to each of files; tmp holds the
+ * copies tee makes for all files but the last. When a round fails,
+ * round_file is the first file missing part of its round_len bytes and
+ * round_sent what that file already has
+ */
+typedef struct s_fanout
+{
+	int						src;
+	int						tmp[2];
+	int						*files;
+	int						count;
+	int						started;
+	int						round_file;
+	ssize_t					round_len;
+	ssize_t					round_sent;
+	pthread_t				thread;
+	struct s_fanout			*next;
+}							t_fanout;
+
+int							prepare_fanouts(t_cmd_ctx *cmd_ctx);
+t_fanout					*fanout_new(t_cmd_ctx *cmd_ctx, int count);
+void						close_fanout_fds(t_command *cmd);
+void						finish_fanouts(t_cmd_ctx *cmd_ctx);
+void						*fanout_pump(void *arg);
+void						fanout_copy(t_fanout *f);
+void						finish_forked_stage(t_cmd_ctx *cmd_ctx);
+
+/* ===================== PROCESS SUBSTITUTION ===================== */
+# define PROCSUBST_MAX 16
+
+typedef struct s_procsubst
+{
+	int						fds[PROCSUBST_MAX];
+	pid_t					pids[PROCSUBST_MAX];
+	int						count;
+}							t_procsubst;
+
+t_procsubst					*procsubst_fds(void);
+void						close_high_fds(int keep);
+void						procsubst_close_all(int wait);
+void						procsubst_forget(void);
+int							procsubst_start(char *text, char dir, char **envp);
+void						procsubst_expand(t_command *cmd, char **envp);
+
+/* ===================== GROUPS AND SEQUENCES ===================== */
+int							mark_group_tokens(t_token *tokens);
+int							parse_syntax_error(t_token *token);
+int							is_list_end(t_token *token);
+t_sequence					*parse_sequence(t_token **tokens);
+t_sequence					*parse_command_line(t_token *tokens);
+int							handle_group_token(t_token **current,
+								t_command **first_cmd, t_command **current_cmd);
+void						free_sequence(t_sequence *seq);
+int							execute_sequence(t_sequence *seq,
+								t_env **env_list);
+int							setup_sequence_heredocs(t_sequence *seq,
+								char **envp);
+
+/* ===================== CHILD EVENTS ===================== */
+# define EVENTS_MAX 16
+# define EVENT_SIGNAL 0
+# define EVENT_TIMER 1
+# define TIMEOUT_STATUS 124
+# define TIMEOUT_FAILURE 125
+# define TIMEOUT_GRACE_MS 2000
+
+/**
+ * The shell's epoll set: the signalfd for SIGINT, SIGQUIT and SIGTTOU,
+ * which stay blocked in the shell, and one pidfd per child still running.
+ * Each pidfd is keyed by pid << 32 | fd. usage sums the rusage of the
+ * children reaped by the last wait; PIPELINE_STATS reports it. sigint
+ * says a Ctrl-C reached the shell during that wait.
+ * A pipeline with a time limit gets its own process group, pgid, and a
+ * timerfd; expired counts the signals already sent to the group
+ */
+typedef struct s_events
+{
+	int						epfd;
+	int						sigfd;
+	int						watched;
+	int						untracked;
+	int						status;
+	int						sigint;
+	struct rusage			usage;
+	long					limit_ms;
+	long					grace_ms;
+	int						timerfd;
+	pid_t					pgid;
+	int						tty;
+	int						expired;
+}							t_events;
+
+t_events					*shell_events(void);
+int							events_open(void);
+void						events_close(void);
+int							events_drain_signals(void);
+void						reaper_watch(pid_t pid);
+int							reap_children(pid_t last_pid);
+void						usage_report(t_env *env_list);
+
+/* ===================== TIMEOUT ===================== */
+int							parse_duration(const char *s, long *ms);
+int							take_pipeline_timeout(t_command *cmd_list,
+								t_env *env_list);
+void						timeout_start(t_env *env_list);
+void						timeout_expired(t_events *ev);
+int							timeout_finish(int status);
+void						process_group_join(void);
+void						process_group_track(pid_t pid);
+
+/* ===================== ULIMIT ===================== */
+# define ULIMIT_SOFT 1
+# define ULIMIT_HARD 2
+# define ULIMIT_OPTS "cfmnstuv"
+# define ULIMIT_MAX 8
+
+typedef struct s_limit_info
+{
+	char					opt;
+	int						resource;
+	char					*name;
+	char					*unit_name;
+	rlim_t					scale;
+}							t_limit_info;
+
+/**
+ * Options of one `ulimit` call: which holds ULIMIT_SOFT and ULIMIT_HARD
+ * as given, opts the resource letters in order
+ */
+typedef struct s_ulimit
+{
+	int						which;
+	int						all;
+	char					opts[ULIMIT_MAX + 1];
+	int						count;
+}							t_ulimit;
+
+int							limit_info(char opt, t_limit_info *info);
+int							print_limit(t_limit_info *info, int hard,
+								int labelled);
+int							builtin_ulimit(t_cmd_ctx *cmd_ctx);
+int							ulimit_command_index(t_command *cmd);
+int							ulimit_run_command(t_cmd_ctx *cmd_ctx, int index);
+
+/* ===================== PARALLEL ===================== */
+# define PARALLEL_SEP ":::"
+# define PARALLEL_READ 65536
+# define PARALLEL_MAX_FAILED 101
+# define PARALLEL_KEY_SIGNAL UINT64_MAX
+
+/**
+ * One job of `parallel`: its stdout is collected in buf until every job
+ * before it has been printed. out is -1 once the pipe reached end of
+ * file, pid is 0 once the child was reaped
+ */
+typedef struct s_job
+{
+	pid_t					pid;
+	int						pidfd;
+	int						out;
+	int						status;
+	t_subst_buf				buf;
+}							t_job;
+
+typedef struct s_parallel
+{
+	t_cmd_ctx				*ctx;
+	char					**tmpl;
+	int						tmpl_count;
+	char					**inputs;
+	t_job					*jobs;
+	int						count;
+	int						limit;
+	int						next;
+	int						running;
+	int						flushed;
+	int						failed;
+	int						stop;
+	int						epfd;
+}							t_parallel;
+
+int							builtin_parallel(t_cmd_ctx *cmd_ctx);
+int							parallel_watch(int epfd, int fd, uint64_t key);
+int							parallel_spawn(t_parallel *p);
+int							parallel_run(t_parallel *p);
+
+/* ===================== FD PASSING ===================== */
+# define FD_PASS_MAX 4
+# define FD_PASS_CTL CMSG_SPACE(sizeof(int) * FD_PASS_MAX)
+
+int							fd_send(int sock, struct iovec *iov, const int *fds,
+								int count);
+ssize_t						fd_receive(int sock, struct iovec *iov, int *fds,
+								int count);
+
+/* ===================== ZYGOTE ===================== */
+# define ZYGOTE_FDS 4
+# define ZYGOTE_MAX_LEN 4194304
+
+/**
+ * Helper forked at launch, while the shell is still small, to spawn
+ * external commands for it. Its children are clone()d with CLONE_PARENT,
+ * so the shell reaps them like its own. Only the process that started
+ * it (owner) may use the socket
+ */
+typedef struct s_zygote
+{
+	int						sock;
+	pid_t					pid;
+	pid_t					owner;
+}							t_zygote;
+
+/**
+ * Sent with the command's stdin, stdout, stderr and working directory
+ * attached; followed by len bytes holding the path, argc words and envc
+ * environment entries, each NUL-terminated. The shell forks commands
+ * whose payload is longer than ZYGOTE_MAX_LEN itself
+ */
+typedef struct s_zygote_req
+{
+	size_t					len;
+	int						argc;
+	int						envc;
+}							t_zygote_req;
+
+t_zygote					*zygote(void);
+int							zygote_start(void);
+void						zygote_stop(void);
+pid_t						zygote_spawn(t_cmd_ctx *cmd_ctx);
+void						zygote_serve(int sock);
+pid_t						spawn_stage(t_cmd_ctx *cmd_ctx);
+
+/* ===================== SERVER ===================== */
+# define SERVER_FDS 3
+# define SERVER_MAX_LINE 1048576
+
+/**
+ * `minishell --server PATH`: every connection gets a forked copy of the
+ * shell, which keeps its variables and directory across the commands
+ * sent on it. owner is that copy's pid, for the exit hook
+ */
+typedef struct s_server
+{
+	int						sock;
+	pid_t					owner;
+}							t_server;
+
+/**
+ * Sent with the client's stdin, stdout and stderr attached; followed by
+ * the len bytes of a command line. The answer is the status as an int.
+ * A len above SERVER_MAX_LINE ends the session
+ */
+typedef struct s_server_req
+{
+	size_t					len;
+}							t_server_req;
+
+t_server					*server_state(void);
+int							server_run(const char *path, t_env **env_list);
+void						server_session(int sock, t_env **env_list);
+
+/* ===================== LAUNCH PLAN ===================== */
+
+/**
+ * What planning worked out for a stage before the first fork: the
+ * environment and executable its child will use, the fds of its process
+ * substitutions, or that it failed and only gets an empty pipe
+ */
+typedef struct s_stage
+{
+	t_command				*cmd;
+	char					**envp;
+	char					*path;
+	t_procsubst				procsubst;
+	int						failed;
+}							t_stage;
+
+/**
+ * Times in microseconds: the planning pass, and the first and last fork
+ * of the stages. LAUNCH_STATS reports them after each pipeline
+ */
+typedef struct s_launch
+{
+	t_stage					*stages;
+	int						count;
+	long					plan_us;
+	long					first_us;
+	long					last_us;
+}							t_launch;
+
+int							launch_plan(t_cmd_ctx *cmd_ctx, t_launch *launch);
+void						launch_free(t_launch *launch);
+pid_t						launch_pipeline(t_cmd_ctx *cmd_ctx,
+								t_launch *launch);
+void						launch_report(t_launch *launch, t_env *env_list);
+char						**stage_envp(t_cmd_ctx *cmd_ctx);
+char						*stage_path(t_cmd_ctx *cmd_ctx, char **envp);
+long						monotonic_us(void);
+
+/* ===================== BUILTIN REGISTRY ===================== */
+
+/**
+ * BUILTIN_PARENT: only has an effect when run by the shell itself
+ * BUILTIN_NO_FORK: harmless to run in the shell when it stands alone
+ * BUILTIN_OUTPUT_ONLY: only prints, so $(...) can capture it in the shell
+ * BUILTIN_READS_STDIN: consumes its standard input
+ * BUILTIN_NO_OPTIONS: any -option is left to the external command
+ */
+# define BUILTIN_PARENT 1
+# define BUILTIN_NO_FORK 2
+# define BUILTIN_OUTPUT_ONLY 4
+# define BUILTIN_READS_STDIN 8
+# define BUILTIN_NO_OPTIONS 16
+
+/**
+ * Slots of the name index; the hash in builtins_registry.c puts every
+ * registered name in a slot of its own
+ */
+# define BUILTIN_SLOTS 32
+
+typedef int					(*t_builtin_fn)(t_cmd_ctx *cmd_ctx);
+
+typedef struct s_builtin
+{
+	const char				*name;
+	t_builtin_fn			run;
+	int						flags;
+}							t_builtin;
+
+const t_builtin				*builtin_lookup(const char *name);
+const t_builtin				*command_builtin(t_command *cmd);
+
+/* ===================== TEST BUILTIN ===================== */
+
+/**
+ * The words between `test` (or `[`) and the end (or `]`); `pos` is the
+ * next word to read and `failed` is set once a syntax error is reported
+ */
+typedef struct s_test
+{
+	char					*name;
+	char					**argv;
+	int						end;
+	int						pos;
+	int						failed;
+}							t_test;
+
+int							builtin_test(t_cmd_ctx *cmd_ctx);
+int							test_error(t_test *t, char *word, char *msg);
+int							test_or(t_test *t);
+int							test_term(t_test *t);
+int							test_unary(char *op, char *arg);
+int							test_binary(t_test *t, char *left, char *op,
+								char *right);
+int							test_file(char op, const char *path);
+int							test_file_compare(char *left, char *op,
+								char *right);
+
+/* ===================== BUILTIN OUTPUT ===================== */
+
+# define OUTBUF_SIZE 65536
+
+/**
+ * Output of a builtin, gathered so that it reaches stdout in a few large
+ * writes. Flushed when full and before the builtin returns; `failed`
+ * keeps the first write error
+ */
+typedef struct s_outbuf
+{
+	int						fd;
+	int						failed;
+	size_t					len;
+	char					data[OUTBUF_SIZE];
+}							t_outbuf;
+
+t_outbuf					*builtin_out(void);
+void						outbuf_put(t_outbuf *out, const char *s,
+								size_t len);
+void						outbuf_fill(t_outbuf *out, char c, int count);
+int							outbuf_flush(t_outbuf *out);
+
+/* ===================== PRINTF BUILTIN ===================== */
+
+/**
+ * Base 10^9 limbs needed for the integer part of the largest long double
+ */
+# define PRINTF_BIG_LIMBS 560
+
+/**
+ * One conversion: flags, `width` and `precision` (-1 when not given)
+ * and the conversion character
+ */
+typedef struct s_fmt_spec
+{
+	int						left;
+	int						plus;
+	int						space;
+	int						alt;
+	int						zero;
+	int						width;
+	int						precision;
+	char					conv;
+}							t_fmt_spec;
+
+/**
+ * `next` indexes the argument the next conversion takes; `stop` ends
+ * the output early, after `\c` in a %b argument or a bad format
+ */
+typedef struct s_printf
+{
+	t_outbuf				*out;
+	char					**args;
+	int						count;
+	int						next;
+	int						status;
+	int						stop;
+}							t_printf;
+
+/**
+ * A numeric argument as read: its magnitude and sign, whether the
+ * digits ran past what 64 bits hold and, for %f, the power of ten that
+ * scales the magnitude
+ */
+typedef struct s_fmt_num
+{
+	unsigned long long		mag;
+	int						negative;
+	int						overflow;
+	int						exp10;
+}							t_fmt_num;
+
+int							builtin_printf(t_cmd_ctx *cmd_ctx);
+char						*printf_arg(t_printf *p);
+void						printf_error(t_printf *p, char *word,
+								char *msg);
+const char					*printf_conversion(t_printf *p, const char *fmt);
+void						printf_string(t_printf *p, t_fmt_spec *spec,
+								const char *s, size_t len);
+void						printf_number(t_printf *p, t_fmt_spec *spec,
+								const char *prefix, const char *digits);
+int							printf_escape(const char *s, char *c, int in_arg);
+void						printf_b(t_printf *p, t_fmt_spec *spec);
+long long					printf_int_arg(t_printf *p, int is_unsigned);
+int							printf_digits(char *buf, unsigned long long v,
+								const char *alphabet, int min);
+void						printf_integer(t_printf *p, t_fmt_spec *spec);
+long double					printf_float_arg(t_printf *p);
+long double					printf_pow10(int e);
+char						*printf_big_integer(long double v);
+char						*printf_fixed(long double v, int precision,
+								int alt);
+void						printf_float(t_printf *p, t_fmt_spec *spec);
 #endif
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_group.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:31:57 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:31:57 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+int	parse_syntax_error(t_token *token)
+{
+	ft_fprintf_fd(2, "minishell: syntax error near unexpected token `");
+	if (token)
+		ft_fprintf_fd(2, "%s'\n", token->content);
+	else
+		ft_fprintf_fd(2, "newline'\n");
+	g_last_exit_status = 2;
+	return (0);
+}
+
+/*
+ * A pipeline ends at `;` and at the token closing the group it sits in
+ */
+int	is_list_end(t_token *token)
+{
+	return (!token || token->type == TOKEN_SEMI || token->type == TOKEN_RPAREN
+		|| token->type == TOKEN_RBRACE);
+}
+
+static t_sequence	*sequence_push(t_sequence **tail, t_command *pipeline)
+{
+	t_sequence	*node;
+
+	node = malloc(sizeof(t_sequence));
+	if (!node)
+		return (NULL);
+	node->pipeline = pipeline;
+	node->next = NULL;
+	*tail = node;
+	return (node);
+}
+
+/*
+ * Parses pipelines separated by `;` up to the end of the input or the
+ * closer of the enclosing group, which is left in *tokens
+ */
+t_sequence	*parse_sequence(t_token **tokens)
+{
+	t_sequence	*head;
+	t_sequence	**tail;
+	t_command	*pipeline;
+
+	head = NULL;
+	tail = &head;
+	while (*tokens && (*tokens)->type != TOKEN_RPAREN
+		&& (*tokens)->type != TOKEN_RBRACE)
+	{
+		pipeline = create_cmds(tokens);
+		if (!pipeline)
+			return (free_sequence(head), NULL);
+		if (!sequence_push(tail, pipeline))
+			return (free_command_list(pipeline), free_sequence(head), NULL);
+		tail = &(*tail)->next;
+		if (*tokens && (*tokens)->type == TOKEN_SEMI)
+			*tokens = (*tokens)->next;
+	}
+	if (!head)
+		parse_syntax_error(*tokens);
+	return (head);
+}
+
+t_sequence	*parse_command_line(t_token *tokens)
+{
+	t_sequence	*seq;
+
+	if (!mark_group_tokens(tokens))
+		return (NULL);
+	seq = parse_sequence(&tokens);
+	if (seq && tokens)
+	{
+		parse_syntax_error(tokens);
+		free_sequence(seq);
+		return (NULL);
+	}
+	return (seq);
+}
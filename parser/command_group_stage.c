@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_group_stage.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:09:16 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 20:09:16 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static t_command	*new_group_command(t_token *open, t_command **first_cmd,
+		t_command **current_cmd)
+{
+	t_command	*cmd;
+
+	cmd = command_init();
+	if (!cmd)
+		return (NULL);
+	cmd->group_kind = GROUP_BRACE;
+	if (open->type == TOKEN_LPAREN)
+		cmd->group_kind = GROUP_SUBSHELL;
+	if (!*first_cmd)
+		*first_cmd = cmd;
+	else if (*current_cmd)
+		(*current_cmd)->next = cmd;
+	*current_cmd = cmd;
+	return (cmd);
+}
+
+/*
+ * The group becomes one pipeline stage; redirections written after its
+ * closer attach to that stage like they would to a simple command
+ */
+int	handle_group_token(t_token **current, t_command **first_cmd,
+		t_command **current_cmd)
+{
+	t_command		*cmd;
+	t_token_type	closer;
+
+	closer = TOKEN_RBRACE;
+	if ((*current)->type == TOKEN_LPAREN)
+		closer = TOKEN_RPAREN;
+	cmd = new_group_command(*current, first_cmd, current_cmd);
+	if (!cmd)
+		return (0);
+	*current = (*current)->next;
+	cmd->group = parse_sequence(current);
+	if (!cmd->group)
+		return (0);
+	if (!*current || (*current)->type != closer)
+		return (parse_syntax_error(*current));
+	*current = (*current)->next;
+	if (*current && (*current)->type == TOKEN_WORD)
+		return (parse_syntax_error(*current));
+	return (1);
+}
+
+void	free_sequence(t_sequence *seq)
+{
+	t_sequence	*next;
+
+	while (seq)
+	{
+		next = seq->next;
+		free_command_list(seq->pipeline);
+		free(seq);
+		seq = next;
+	}
+}
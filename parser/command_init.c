@@ -22,6 +22,8 @@ t_command	*command_init(void)
 	cmd->args = NULL;
 	cmd->args_count = 0;
 	cmd->redirections = NULL;
+	cmd->group = NULL;
+	cmd->group_kind = GROUP_NONE;
 	cmd->next = NULL;
 	return (cmd);
 }
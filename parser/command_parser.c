@@ -44,10 +44,7 @@ static int	handle_pipe_with_redirection(t_token *current,
 {
 	t_command	*new_cmd;
 
-	if (current->next && ((current)->type == TOKEN_REDIRECT_IN
-			|| (current)->type == TOKEN_HEREDOC
-			|| (current)->type == TOKEN_REDIRECT_OUT
-			|| (current)->type == TOKEN_APPEND))
+	if (current->next && is_redirect_token(current->type))
 	{
 		new_cmd = command_init();
 		if (!new_cmd)
@@ -61,6 +58,8 @@ static int	handle_pipe_with_redirection(t_token *current,
 static int	process_token(t_token **current, t_command **first_cmd,
 		t_command **current_cmd)
 {
+	if ((*current)->type == TOKEN_LPAREN || (*current)->type == TOKEN_LBRACE)
+		return (handle_group_token(current, first_cmd, current_cmd));
 	if ((*current)->type == TOKEN_WORD)
 	{
 		if (!handle_word_token(current, first_cmd, current_cmd))
@@ -73,10 +72,7 @@ static int	process_token(t_token **current, t_command **first_cmd,
 			return (0);
 		*current = (*current)->next;
 	}
-	else if ((*current)->type == TOKEN_REDIRECT_IN
-		|| (*current)->type == TOKEN_HEREDOC
-		|| (*current)->type == TOKEN_REDIRECT_OUT
-		|| (*current)->type == TOKEN_APPEND)
+	else if (is_redirect_token((*current)->type))
 	{
 		if (!handle_redirect_token(current, first_cmd, current_cmd))
 			return (0);
@@ -86,6 +82,10 @@ static int	process_token(t_token **current, t_command **first_cmd,
 	return (1);
 }
 
+/*
+ * Parses one pipeline and leaves *tokens on the `;` or group closer that
+ * ended it
+ */
 t_command	*create_cmds(t_token **tokens)
 {
 	t_command	*first_cmd;
@@ -95,7 +95,7 @@ t_command	*create_cmds(t_token **tokens)
 	first_cmd = NULL;
 	current_cmd = NULL;
 	current = *tokens;
-	while (current)
+	while (!is_list_end(current))
 	{
 		if (!process_token(&current, &first_cmd, &current_cmd))
 		{
@@ -104,5 +104,8 @@ t_command	*create_cmds(t_token **tokens)
 			return (NULL);
 		}
 	}
+	*tokens = current;
+	if (!first_cmd)
+		return (parse_syntax_error(current), NULL);
 	return (finish_command_parsing(first_cmd));
 }
@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_redirect_apply.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:24:48 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 13:24:48 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Heredocs, here-strings and fan-out groups come with a descriptor the
+ * shell prepared before the fork
+ */
+static int	setup_redirect_prepared(t_redirections *redir)
+{
+	if (dup2(redir->heredoc_fd, redirect_target_fd(redir)) == -1)
+	{
+		ft_fprintf_fd(2, "minishell: redirection failed: %s\n",
+			strerror(errno));
+		return (-1);
+	}
+	safe_close(&redir->heredoc_fd);
+	return (0);
+}
+
+static int	handle_single_redirection(t_redirections *redir)
+{
+	if (!redirect_fd_in_range(redir))
+		return (-1);
+	if (redir->fanout == FANOUT_MEMBER)
+		return (0);
+	if (redir->type == TOKEN_HEREDOC || redir->type == TOKEN_HERESTRING
+		|| redir->fanout == FANOUT_LEAD)
+		return (setup_redirect_prepared(redir));
+	if (redir->type == TOKEN_REDIRECT_IN)
+		return (setup_redirect_in(redir));
+	else if (redir->type == TOKEN_REDIRECT_OUT
+		|| redir->type == TOKEN_APPEND)
+		return (setup_redirect_out(redir));
+	else if (redir->type == TOKEN_DUP_IN || redir->type == TOKEN_DUP_OUT)
+		return (setup_redirect_dup(redir));
+	ft_putstr_fd("minishell: unknown redirection type\n", 2);
+	return (-1);
+}
+
+int	setup_redirections(t_command *cmd)
+{
+	t_redirections	*redir;
+	int				result;
+
+	redir = cmd->redirections;
+	result = 0;
+	while (redir && result == 0)
+	{
+		result = handle_single_redirection(redir);
+		redir = redir->next;
+	}
+	return (result);
+}
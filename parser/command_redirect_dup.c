@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_redirect_dup.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:50:53 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:50:53 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Without a leading `N`, output operators act on stdout and the others
+ * on stdin
+ */
+int	redirect_target_fd(t_redirections *redir)
+{
+	if (redir->fd != -1)
+		return (redir->fd);
+	if (redir->type == TOKEN_REDIRECT_OUT || redir->type == TOKEN_APPEND
+		|| redir->type == TOKEN_DUP_OUT)
+		return (STDOUT_FILENO);
+	return (STDIN_FILENO);
+}
+
+/*
+ * Descriptors from REDIRECT_FRAME_MIN_FD up belong to the shell
+ */
+int	redirect_fd_in_range(t_redirections *redir)
+{
+	if (redirect_target_fd(redir) < REDIRECT_FRAME_MIN_FD)
+		return (1);
+	ft_putstr_fd("minishell: ", 2);
+	ft_putnbr_fd(redirect_target_fd(redir), 2);
+	ft_putstr_fd(": Bad file descriptor\n", 2);
+	return (0);
+}
+
+static int	is_fd_word(const char *s)
+{
+	int	i;
+
+	i = 0;
+	while (ft_isdigit(s[i]))
+		i++;
+	return (i > 0 && i < 5 && s[i] == '\0');
+}
+
+/*
+ * `N>&M` and `N<&M` make N a copy of M, `N>&-` and `N<&-` close N
+ */
+int	setup_redirect_dup(t_redirections *redir)
+{
+	int	target;
+	int	source;
+
+	target = redirect_target_fd(redir);
+	if (ft_strcmp(redir->file, "-") == 0)
+	{
+		close(target);
+		return (0);
+	}
+	if (!is_fd_word(redir->file))
+		return (ft_fprintf_fd(2, "minishell: %s: ambiguous redirect\n",
+				redir->file), -1);
+	source = ft_atoi(redir->file);
+	if (source >= REDIRECT_FRAME_MIN_FD || fcntl(source, F_GETFD) == -1)
+		return (ft_fprintf_fd(2, "minishell: %s: Bad file descriptor\n",
+				redir->file), -1);
+	if (source != target && dup2(source, target) == -1)
+		return (ft_fprintf_fd(2, "minishell: %s: %s\n", redir->file,
+				strerror(errno)), -1);
+	return (0);
+}
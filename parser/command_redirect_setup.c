@@ -28,86 +28,61 @@ static int	is_ambiguous_redirect(char *file_path, int was_in_squotes,
 	return (0);
 }
 
-int	setup_redirect_in(char *file_path, int was_in_squotes, int was_in_dquotes)
+int	setup_redirect_in(t_redirections *redir)
 {
 	int	fd;
 
-	if (is_ambiguous_redirect(file_path, was_in_squotes, was_in_dquotes))
+	if (is_ambiguous_redirect(redir->file, redir->was_in_squotes,
+			redir->was_in_dquotes))
 		return (ft_fprintf_fd(2, "minishell: %s: ambiguous redirect\n",
-				file_path), -1);
-	fd = open(file_path, O_RDONLY);
+				redir->file), -1);
+	fd = open(redir->file, O_RDONLY | O_CLOEXEC);
 	if (fd == -1)
-		return (ft_fprintf_fd(2, "minishell: "), perror(file_path), -1);
-	if (dup2(fd, STDIN_FILENO) == -1)
+		return (ft_fprintf_fd(2, "minishell: "), perror(redir->file), -1);
+	if (fd == redirect_target_fd(redir))
+		return (fcntl(fd, F_SETFD, 0), 0);
+	if (dup2(fd, redirect_target_fd(redir)) == -1)
 		return (ft_fprintf_fd(2, "minishell: input redirection failed: %s\n",
 				strerror(errno)), close(fd), -1);
 	close(fd);
 	return (0);
 }
 
-int	setup_redirect_out(char *file_path, int append_mode, int was_in_squotes,
-		int was_in_dquotes)
+/*
+ * Opens the file of a `>` or `>>` without installing it, for callers that
+ * place the descriptor themselves
+ */
+int	open_redirect_out(t_redirections *redir)
 {
 	int	flags;
 	int	fd;
 
-	if (is_ambiguous_redirect(file_path, was_in_squotes, was_in_dquotes))
+	if (is_ambiguous_redirect(redir->file, redir->was_in_squotes,
+			redir->was_in_dquotes))
 		return (ft_fprintf_fd(2, "minishell: %s: ambiguous redirect\n",
-				file_path), -1);
-	flags = O_WRONLY | O_CREAT;
-	if (append_mode)
+				redir->file), -1);
+	flags = O_WRONLY | O_CREAT | O_CLOEXEC;
+	if (redir->type == TOKEN_APPEND)
 		flags |= O_APPEND;
 	else
 		flags |= O_TRUNC;
-	fd = open(file_path, flags, 0644);
+	fd = open(redir->file, flags, 0644);
 	if (fd == -1)
-		return (ft_fprintf_fd(2, "minishell: "), perror(file_path), -1);
-	if (dup2(fd, STDOUT_FILENO) == -1)
-		return (ft_fprintf_fd(2, "minishell: output redirection failed: %s\n",
-				strerror(errno)), close(fd), -1);
-	return (close(fd), 0);
-}
-
-static int	handle_single_redirection(t_redirections *redir)
-{
-	int	result;
-
-	result = 0;
-	if (redir->type == TOKEN_REDIRECT_IN)
-		result = setup_redirect_in(redir->file, redir->was_in_squotes,
-				redir->was_in_dquotes);
-	else if (redir->type == TOKEN_REDIRECT_OUT)
-		result = setup_redirect_out(redir->file, 0, redir->was_in_squotes,
-				redir->was_in_dquotes);
-	else if (redir->type == TOKEN_APPEND)
-		result = setup_redirect_out(redir->file, 1, redir->was_in_squotes,
-				redir->was_in_dquotes);
-	else if (redir->type == TOKEN_HEREDOC)
-	{
-		if (dup2(redir->heredoc_fd, STDIN_FILENO) == -1)
-			return (ft_fprintf_fd(2, "minishell: heredoc redirection "),
-				ft_fprintf_fd(2, "failed: %s\n", strerror(errno)) - 1);
-		safe_close(&redir->heredoc_fd);
-	}
-	else
-	{
-		ft_putstr_fd("minishell: unknown redirection type\n", 2);
-		result = -1;
-	}
-	return (result);
+		return (ft_fprintf_fd(2, "minishell: "), perror(redir->file), -1);
+	return (fd);
 }
 
-int	setup_redirections(t_command *cmd)
+int	setup_redirect_out(t_redirections *redir)
 {
-	t_redirections	*redir;
-	int				result;
+	int	fd;
 
-	redir = cmd->redirections;
-	result = 0;
-	while (redir && result == 0)
-	{
-		result = handle_single_redirection(redir);
-		redir = redir->next;
-	}
-	return (result);
+	fd = open_redirect_out(redir);
+	if (fd == -1)
+		return (-1);
+	if (fd == redirect_target_fd(redir))
+		return (fcntl(fd, F_SETFD, 0), 0);
+	if (dup2(fd, redirect_target_fd(redir)) == -1)
+		return (ft_fprintf_fd(2, "minishell: output redirection failed: %s\n",
+				strerror(errno)), close(fd), -1);
+	return (close(fd), 0);
 }
@@ -51,15 +51,16 @@ static int	check_redirect_syntax(t_token **current)
 int	handle_redirect_token(t_token **current, t_command **first_cmd,
 		t_command **current_cmd)
 {
-	t_token_type	redirect_type;
+	t_token	*op;
 
 	if (!create_cmd_if_needed(first_cmd, current_cmd))
 		return (0);
-	redirect_type = (*current)->type;
+	op = *current;
 	*current = (*current)->next;
 	if (!check_redirect_syntax(current))
 		return (0);
-	add_redirection(*current_cmd, redirect_type, (*current)->content);
+	add_redirection(*current_cmd, op->type, (*current)->content,
+		op->io_number);
 	*current = (*current)->next;
 	if (*current && (*current)->type == TOKEN_WORD)
 		add_words_as_args(*current_cmd, current);
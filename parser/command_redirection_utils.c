@@ -12,7 +12,8 @@
 
 #include "../minishell.h"
 
-void	add_redirection(t_command *cmd, t_token_type redirect_type, char *file)
+void	add_redirection(t_command *cmd, t_token_type redirect_type, char *file,
+		int io_number)
 {
 	t_redirections	*redirection;
 	t_redirections	*current;
@@ -23,10 +24,10 @@ void	add_redirection(t_command *cmd, t_token_type redirect_type, char *file)
 	redirection->type = redirect_type;
 	redirection->was_in_squotes = is_var_in_squotes(file);
 	redirection->was_in_dquotes = has_var_in_dquotes(file);
-	file = strip_quotes(file);
-	redirection->file = ft_strdup(file);
-	safe_free((void **)&file);
+	redirection->file = strip_quotes(file);
 	redirection->heredoc_fd = -1;
+	redirection->fd = io_number;
+	redirection->fanout = FANOUT_NONE;
 	redirection->next = NULL;
 	if (!redirection->file)
 		return (safe_free((void **)&redirection));
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:19:03 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 19:19:03 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+t_server	*server_state(void)
+{
+	static t_server	s;
+
+	return (&s);
+}
+
+/*
+ * A socket left behind by an earlier server is replaced; any other file
+ * at path is an error
+ */
+static int	server_listen(const char *path)
+{
+	struct sockaddr_un	addr;
+	struct stat			st;
+	int					sock;
+
+	ft_bzero(&addr, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (ft_strlen(path) >= sizeof(addr.sun_path))
+		return (errno = ENAMETOOLONG, -1);
+	ft_memcpy(addr.sun_path, path, ft_strlen(path));
+	if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+		unlink(path);
+	sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (sock < 0)
+		return (-1);
+	if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) == -1
+		|| listen(sock, SOMAXCONN) == -1)
+		return (close(sock), -1);
+	return (sock);
+}
+
+/*
+ * Finished sessions are reaped by the kernel (SA_NOCLDWAIT), so an idle
+ * server keeps no zombies. Sessions put SIGCHLD back to its default:
+ * they wait for the commands they run
+ */
+static void	reap_sessions(void)
+{
+	struct sigaction	sa;
+
+	ft_bzero(&sa, sizeof(sa));
+	sa.sa_handler = SIG_DFL;
+	sa.sa_flags = SA_NOCLDWAIT;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGCHLD, &sa, NULL);
+}
+
+/*
+ * Accepts connections until the server is killed, forking a session for
+ * each. The environment was read once, before the first fork
+ */
+int	server_run(const char *path, t_env **env_list)
+{
+	int		lsock;
+	int		sock;
+	pid_t	pid;
+
+	lsock = server_listen(path);
+	if (lsock < 0)
+		return (ft_fprintf_fd(2, "minishell: %s: %s\n", (char *)path,
+				strerror(errno)), 1);
+	reap_sessions();
+	while (1)
+	{
+		sock = accept4(lsock, NULL, NULL, SOCK_CLOEXEC);
+		if (sock < 0 && (errno == EINTR || errno == ECONNABORTED))
+			continue ;
+		if (sock < 0)
+			return (ft_fprintf_fd(2, "minishell: accept: %s\n",
+					strerror(errno)), close(lsock), 1);
+		pid = fork();
+		if (pid == 0)
+		{
+			close(lsock);
+			server_session(sock, env_list);
+		}
+		close(sock);
+	}
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_session.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:22:44 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:22:44 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * `exit` ends the session from inside process_command: the status it
+ * exits with still answers the command that ran it. Forked stages run
+ * the hook too, and are told apart by their pid
+ */
+static void	session_exit(int status, void *arg)
+{
+	t_server	*s;
+
+	(void)arg;
+	s = server_state();
+	if (s->sock >= 0 && s->owner == getpid())
+		send_all(s->sock, (char *)&status, sizeof(status));
+}
+
+/*
+ * Between commands the session holds none of the client's descriptors,
+ * so a client's pipe sees end of file as soon as the client closes it
+ */
+static void	null_stdio(void)
+{
+	int	fd;
+
+	fd = open("/dev/null", O_RDWR);
+	if (fd < 0)
+		exit(1);
+	dup2(fd, STDIN_FILENO);
+	dup2(fd, STDOUT_FILENO);
+	dup2(fd, STDERR_FILENO);
+	if (fd > STDERR_FILENO)
+		close(fd);
+}
+
+/*
+ * The command line announced by req, or NULL when it is longer than
+ * SERVER_MAX_LINE or the client hangs up before sending all of it. The
+ * descriptors that came with a rejected request are closed
+ */
+static char	*receive_line(int sock, t_server_req *req, int fds[SERVER_FDS])
+{
+	char	*line;
+	int		i;
+
+	line = NULL;
+	if (req->len <= SERVER_MAX_LINE)
+		line = malloc(req->len + 1);
+	if (line && read_all(sock, line, req->len) == 0)
+		return (line[req->len] = '\0', line);
+	safe_free((void **)&line);
+	i = -1;
+	while (++i < SERVER_FDS)
+		close(fds[i]);
+	return (NULL);
+}
+
+static int	serve_request(int sock, t_env **env_list)
+{
+	t_server_req	req;
+	struct iovec	iov;
+	int				fds[SERVER_FDS];
+	char			*line;
+	int				i;
+
+	iov.iov_base = &req;
+	iov.iov_len = sizeof(req);
+	if (fd_receive(sock, &iov, fds, SERVER_FDS) <= 0)
+		return (0);
+	line = receive_line(sock, &req, fds);
+	if (!line)
+		return (0);
+	i = -1;
+	while (++i < SERVER_FDS)
+	{
+		dup2(fds[i], i);
+		close(fds[i]);
+	}
+	process_command(line, env_list);
+	safe_free((void **)&line);
+	fflush(stdout);
+	null_stdio();
+	return (send_all(sock, (char *)&g_last_exit_status, sizeof(int)) == 0);
+}
+
+/*
+ * One connection, served by a forked copy of the server's shell until
+ * the client hangs up or runs `exit`
+ */
+void	server_session(int sock, t_env **env_list)
+{
+	t_server	*s;
+
+	s = server_state();
+	s->sock = sock;
+	s->owner = getpid();
+	on_exit(session_exit, NULL);
+	signal(SIGCHLD, SIG_DFL);
+	signals_init();
+	null_stdio();
+	while (serve_request(sock, env_list))
+		continue ;
+	s->sock = -1;
+	free_env_list(env_list);
+	exit(g_last_exit_status);
+}
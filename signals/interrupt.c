@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   interrupt.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:51:54 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:51:54 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Set once the shell itself took a Ctrl-C during the current line;
+ * process_command clears it
+ */
+int	*shell_interrupt(void)
+{
+	static int	seen;
+
+	return (&seen);
+}
+
+/*
+ * Consumes a Ctrl-C that arrived while the shell was busy. Safe from the
+ * globstar workers, which have SIGINT blocked like the rest of the shell
+ */
+int	shell_interrupted(void)
+{
+	sigset_t		set;
+	struct timespec	zero;
+
+	sigemptyset(&set);
+	sigaddset(&set, SIGINT);
+	ft_bzero(&zero, sizeof(zero));
+	if (sigtimedwait(&set, NULL, &zero) == SIGINT)
+		__atomic_store_n(shell_interrupt(), 1, __ATOMIC_RELAXED);
+	return (__atomic_load_n(shell_interrupt(), __ATOMIC_RELAXED));
+}
+
+/*
+ * Waits, as a blocking read would, for fd to have data or reach end of
+ * file, and gives up with -1 when Ctrl-C comes first. Other signals on
+ * the signalfd, such as SIGQUIT, are dropped as the prompt drops them
+ */
+int	wait_readable(int fd)
+{
+	struct pollfd	fds[2];
+	int				count;
+
+	ft_bzero(fds, sizeof(fds));
+	fds[0].fd = fd;
+	fds[0].events = POLLIN;
+	fds[1].fd = shell_events()->sigfd;
+	fds[1].events = POLLIN;
+	count = 1 + (fds[1].fd > 0);
+	while (!shell_interrupted())
+	{
+		if (poll(fds, count, -1) == -1 && errno != EINTR)
+			return (-1);
+		if (fds[0].revents)
+			return (0);
+		if (count == 2 && fds[1].revents && events_drain_signals() == SIGINT)
+			*shell_interrupt() = 1;
+	}
+	return (-1);
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prompt.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:15:13 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 16:15:13 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static t_prompt	*prompt_state(void)
+{
+	static t_prompt	state;
+
+	return (&state);
+}
+
+static void	prompt_line_ready(char *line)
+{
+	prompt_state()->line = line;
+	prompt_state()->done = 1;
+	rl_callback_handler_remove();
+}
+
+/*
+ * Ctrl-C at the prompt drops the line being typed. This used to run in
+ * a signal handler, where readline must not be called
+ */
+static void	prompt_interrupt(void)
+{
+	g_last_exit_status = 130;
+	rl_free_line_state();
+	rl_callback_sigcleanup();
+	write(STDOUT_FILENO, "\n", 1);
+	rl_replace_line("", 0);
+	rl_on_new_line();
+	rl_redisplay();
+}
+
+static void	prompt_wait(t_events *ev)
+{
+	struct epoll_event	events[EVENTS_MAX];
+	int					n;
+
+	while (!prompt_state()->done)
+	{
+		n = epoll_wait(ev->epfd, events, EVENTS_MAX, -1);
+		if (n == -1 && errno != EINTR)
+			return (prompt_line_ready(NULL));
+		while (n-- > 0 && !prompt_state()->done)
+		{
+			if (events[n].data.u64 != EVENT_SIGNAL)
+				rl_callback_read_char();
+			else if (events_drain_signals() == SIGINT)
+				prompt_interrupt();
+		}
+	}
+}
+
+/*
+ * readline's callback interface, driven by the shell's epoll set so that
+ * a signal is just another event. stdin that epoll cannot watch, like a
+ * regular file, is always readable and goes through plain readline()
+ */
+char	*read_prompt_line(const char *prompt)
+{
+	t_events			*ev;
+	struct epoll_event	add;
+
+	ev = shell_events();
+	add.events = EPOLLIN;
+	add.data.u64 = (uint64_t)1 << 32;
+	if (events_open() == -1
+		|| epoll_ctl(ev->epfd, EPOLL_CTL_ADD, STDIN_FILENO, &add) == -1)
+		return (readline(prompt));
+	events_drain_signals();
+	prompt_state()->line = NULL;
+	prompt_state()->done = 0;
+	rl_callback_handler_install(prompt, prompt_line_ready);
+	prompt_wait(ev);
+	epoll_ctl(ev->epfd, EPOLL_CTL_DEL, STDIN_FILENO, NULL);
+	return (prompt_state()->line);
+}
@@ -18,28 +18,54 @@ void	ctrl_d_handle(void)
 	exit(0);
 }
 
-void	sigint_handler(int sig)
+void	child_sigint_handler(int sig)
 {
 	(void)sig;
-	g_last_exit_status = 130;
 	write(STDOUT_FILENO, "\n", 1);
-	rl_on_new_line();
-	rl_replace_line("", 0);
-	rl_redisplay();
+	exit(130);
 }
 
-void	heredoc_sigint_handler(int sig)
+void	shell_sigmask(sigset_t *set)
 {
-	(void)sig;
-	g_last_exit_status = 130;
-	write(STDOUT_FILENO, "\n", 1);
-	rl_on_new_line();
-	rl_replace_line("", 0);
+	sigemptyset(set);
+	sigaddset(set, SIGINT);
+	sigaddset(set, SIGQUIT);
+	sigaddset(set, SIGTTOU);
 }
 
-void	child_sigint_handler(int sig)
+/*
+ * The shell never takes SIGINT or SIGQUIT in a handler: they stay
+ * blocked and are read from the signalfd by the prompt and by
+ * reap_children, outside signal context. SIGTTOU is blocked so the shell
+ * can take the terminal back from a pipeline's process group.
+ * Work the shell does itself between those points has to look for a
+ * Ctrl-C on its own, through shell_interrupted or wait_readable: the
+ * in-shell cat, `$(< file)` and the `**` walk do. Everything else that
+ * could wait on something outside the shell is forked; the one exception
+ * is opening a FIFO named in a redirection of a builtin that runs in the
+ * shell, which blocks until the other end is opened
+ */
+void	signals_init(void)
 {
-	(void)sig;
-	write(STDOUT_FILENO, "\n", 1);
-	exit(130);
+	sigset_t	set;
+
+	shell_sigmask(&set);
+	sigprocmask(SIG_BLOCK, &set, NULL);
+	events_open();
+}
+
+/*
+ * Run first in every forked child: the shell's epoll set is shared with
+ * the parent and must not be touched, and the blocked mask and handlers
+ * would otherwise survive exec
+ */
+void	reset_child_signals(void)
+{
+	sigset_t	set;
+
+	events_close();
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	shell_sigmask(&set);
+	sigprocmask(SIG_UNBLOCK, &set, NULL);
 }
@@ -0,0 +1,29 @@
+#!/bin/bash
+# Brace expansion drops the empty words it produces, as bash does, but
+# keeps quoted empty strings.
+# MINISHELL overrides the binary under test (default ./minishell).
+
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+
+fail=0
+check() {
+	local out
+
+	out=$(printf '%s\n' "$1" | "$BIN" 2>&1 | grep -av '^minishell>')
+	if [ "$out" != "$2" ]; then
+		echo "brace_empty: $1: got '$out', want '$2'"
+		fail=1
+	fi
+}
+count='printf "[%s]" x'
+check "$count a{,}; echo" '[x][a][a]'
+check "$count {,}; echo" '[x]'
+check "$count x{,}y; echo" '[x][xy][xy]'
+check "$count {a,}; echo" '[x][a]'
+check "$count {,}{,}; echo" '[x]'
+check "$count {\"\",}; echo" '[x][]'
+check "$count \"\" {,}; echo" '[x][]'
+check '{,} echo hi' 'hi'
+[ "$fail" = 0 ] && echo "brace_empty: ok"
+exit "$fail"
@@ -0,0 +1,38 @@
+#!/bin/bash
+# A fan-out group that mixes `>` and `>>` must give every file the
+# output exactly once, whichever target comes first. The pump races the
+# writer, so each case runs several times.
+# MINISHELL overrides the binary under test (default ./minishell).
+
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+RUNS=10
+
+head -c 1000000 /dev/urandom > "$DIR/src"
+echo hello > "$DIR/want_a"
+{
+	echo "cd $DIR"
+	for ((i = 0; i < RUNS; i++)); do
+		echo "echo hello > a1_$i >> a2_$i"
+		echo "cat src >> b1_$i > b2_$i > b3_$i"
+	done
+} | "$BIN" > /dev/null 2>&1
+
+fail=0
+check() {
+	if ! cmp -s "$DIR/$1" "$DIR/$2"; then
+		echo "fanout_append: $1 differs from $2"
+		fail=1
+	fi
+}
+for ((i = 0; i < RUNS; i++)); do
+	check "a1_$i" want_a
+	check "a2_$i" want_a
+	check "b1_$i" src
+	check "b2_$i" src
+	check "b3_$i" src
+done
+[ "$fail" = 0 ] && echo "fanout_append: ok"
+exit "$fail"
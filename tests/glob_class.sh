@@ -0,0 +1,31 @@
+#!/bin/bash
+# `*`, `?` and `[` inside a bracket expression are members of the set,
+# whether the pattern was typed or came from an unquoted variable.
+# MINISHELL overrides the binary under test (default ./minishell).
+
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+
+touch "$DIR/*x" "$DIR/?x" "$DIR/[x" "$DIR/ax" "$DIR/qx"
+fail=0
+check() {
+	local out
+
+	out=$(printf 'cd %s\n%s\n' "$DIR" "$1" | "$BIN" 2>&1 \
+		| grep -av '^minishell>')
+	if [ "$out" != "$2" ]; then
+		echo "glob_class: $1: got '$out', want '$2'"
+		fail=1
+	fi
+}
+check 'echo [*q]x' '*x qx'
+check 'echo [?]x' '?x'
+check 'echo [[]x' '[x'
+check 'echo [a-b*]x' '*x ax'
+check 'echo [!*?[]x' 'ax qx'
+check 'echo "[*q]x"' '[*q]x'
+check 'export P="[*q]x"; echo $P' '*x qx'
+[ "$fail" = 0 ] && echo "glob_class: ok"
+exit "$fail"
@@ -0,0 +1,35 @@
+#!/bin/bash
+# A trailing `**` lists the directory it starts from as well, as bash
+# does with globstar: `d/**` gives `d/` first, `*/**` gives `d`.
+# MINISHELL overrides the binary under test (default ./minishell).
+
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+
+mkdir -p "$DIR/d/e/f"
+touch "$DIR/d/a" "$DIR/d/e/b" "$DIR/d/e/f/c"
+fail=0
+check() {
+	local out threads
+
+	for threads in 1 4; do
+		out=$(printf 'cd %s\nexport GLOBSTAR_THREADS=%s\n%s\n' "$DIR" \
+			"$threads" "$1" | "$BIN" 2>&1 | grep -av '^minishell>')
+		if [ "$out" != "$2" ]; then
+			echo "globstar_base: $1 ($threads threads): got '$out'," \
+				"want '$2'"
+			fail=1
+		fi
+	done
+}
+check 'echo d/**' 'd/ d/a d/e d/e/b d/e/f d/e/f/c'
+check 'echo d/e/**' 'd/e/ d/e/b d/e/f d/e/f/c'
+check 'echo ./d/**' './d/ ./d/a ./d/e ./d/e/b ./d/e/f ./d/e/f/c'
+check 'echo */**' 'd d/a d/e d/e/b d/e/f d/e/f/c'
+check 'echo **' 'd d/a d/e d/e/b d/e/f d/e/f/c'
+check 'echo d/**/' 'd/ d/e/ d/e/f/'
+check 'echo d/a/**' 'd/a/**'
+[ "$fail" = 0 ] && echo "globstar_base: ok"
+exit "$fail"
@@ -0,0 +1,34 @@
+#!/bin/bash
+# A 500-stage pipeline where every stage has its own heredoc must run
+# under the default 1024 descriptor limit, and its last stage must see
+# only its own descriptors.
+# MINISHELL overrides the binary under test (default ./minishell).
+
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+STAGES=500
+IN=$(mktemp)
+trap 'rm -f "$IN"' EXIT
+
+ulimit -n 1024 || exit 1
+{
+	line=
+	for ((i = 0; i < STAGES; i++)); do line+="cat <<E$i | "; done
+	echo "${line}ls /proc/self/fd"
+	for ((i = 0; i < STAGES; i++)); do echo "body $i"; echo "E$i"; done
+	echo 'echo "status=$?"'
+} > "$IN"
+out=$("$BIN" < "$IN" 2>&1 | grep -av '^minishell> *$')
+
+fail=0
+if ! grep -q '^status=0$' <<< "$out"; then
+	echo "heredoc_fds: pipeline did not exit 0"
+	fail=1
+fi
+fds=$(grep -aE '^[0-9]+$' <<< "$out" | tr '\n' ' ')
+if [ "$fds" != "0 1 2 3 " ]; then
+	echo "heredoc_fds: last stage saw fds: $fds"
+	fail=1
+fi
+[ "$fail" = 0 ] && echo "heredoc_fds: ok"
+exit "$fail"
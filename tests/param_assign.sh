@@ -0,0 +1,29 @@
+#!/bin/bash
+# ${NAME:=word} assigns in the shell only when the command runs in the
+# shell. Pipeline stages, ( ... ) and $(...) are subshells and leave the
+# variable unset, as in bash.
+# MINISHELL overrides the binary under test (default ./minishell).
+
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+
+fail=0
+check() {
+	local out
+
+	out=$(printf '%s\n' "$1" | "$BIN" 2>&1 | grep -av '^minishell>')
+	if [ "$out" != "$2" ]; then
+		echo "param_assign: $1: got '$out', want '$2'"
+		fail=1
+	fi
+}
+check 'echo ${A:=1} > /dev/null; echo [$A]' '[1]'
+check '{ echo ${A:=1} > /dev/null; }; echo [$A]' '[1]'
+check 'echo ${A:=1} | cat > /dev/null; echo [$A]' '[]'
+check '/bin/echo ${A:=1} | cat > /dev/null; echo [$A]' '[]'
+check 'echo ${A:=1} $A | cat' '1 1'
+check '(echo ${A:=1} > /dev/null); echo [$A]' '[]'
+check 'echo $(echo ${A:=1}) > /dev/null; echo [$A]' '[]'
+check 'echo ${A:=1} $(echo ${B:=2}) > /dev/null; echo [$A][$B]' '[1][]'
+[ "$fail" = 0 ] && echo "param_assign: ok"
+exit "$fail"
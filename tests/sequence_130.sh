@@ -0,0 +1,24 @@
+#!/bin/bash
+# A status of 130 that no Ctrl-C caused does not stop a list; only an
+# interrupt the shell took does.
+# MINISHELL overrides the binary under test (default ./minishell).
+
+cd "$(dirname "$0")/.."
+BIN=${MINISHELL:-$PWD/minishell}
+
+fail=0
+check() {
+	local out
+
+	out=$(printf '%s\n' "$1" | "$BIN" 2>&1 | grep -av '^minishell>')
+	if [ "$out" != "$2" ]; then
+		echo "sequence_130: $1: got '$out', want '$2'"
+		fail=1
+	fi
+}
+check '(exit 130); echo next $?' 'next 130'
+check '{ (exit 130); echo in; }; echo out' $'in\nout'
+check 'sh -c "exit 130" | cat; echo next $?' 'next 0'
+check '/bin/sh -c "exit 130"; echo next $?' 'next 130'
+[ "$fail" = 0 ] && echo "sequence_130: ok"
+exit "$fail"
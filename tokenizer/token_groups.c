@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   token_groups.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:59:29 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 17:59:29 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	starts_command(t_token *prev)
+{
+	return (!prev || prev->type == TOKEN_PIPE || prev->type == TOKEN_SEMI
+		|| prev->type == TOKEN_LPAREN || prev->type == TOKEN_LBRACE);
+}
+
+static int	ends_command(t_token *prev)
+{
+	return (prev && (prev->type == TOKEN_SEMI || prev->type == TOKEN_RPAREN
+			|| prev->type == TOKEN_RBRACE));
+}
+
+/*
+ * `{` and `}` are reserved words, not operators: `{` only where a command
+ * starts and `}` only after a `;` or another group closes an open brace.
+ * Anywhere else they stay plain words, so `echo {` still prints it
+ */
+int	mark_group_tokens(t_token *tokens)
+{
+	t_token	*prev;
+	int		depth;
+
+	prev = NULL;
+	depth = 0;
+	while (tokens)
+	{
+		if (tokens->type == TOKEN_WORD && starts_command(prev)
+			&& ft_strcmp(tokens->content, "{") == 0)
+		{
+			tokens->type = TOKEN_LBRACE;
+			depth++;
+		}
+		else if (tokens->type == TOKEN_WORD && depth > 0 && ends_command(prev)
+			&& ft_strcmp(tokens->content, "}") == 0)
+		{
+			tokens->type = TOKEN_RBRACE;
+			depth--;
+		}
+		else if (tokens->type == TOKEN_LPAREN && !starts_command(prev))
+			return (parse_syntax_error(tokens));
+		prev = tokens;
+		tokens = tokens->next;
+	}
+	return (1);
+}
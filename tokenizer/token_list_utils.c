@@ -20,6 +20,7 @@ t_token	*ft_token_new(char *content)
 	if (!new_node)
 		return (NULL);
 	new_node->content = content;
+	new_node->io_number = -1;
 	new_node->next = NULL;
 	return (new_node);
 }
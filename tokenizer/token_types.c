@@ -14,30 +14,73 @@
 
 int	is_operator(char c)
 {
-	return (c == '|' || c == '>' || c == '<');
+	return (c == '|' || c == '>' || c == '<' || c == ';' || c == '('
+		|| c == ')');
 }
 
-char	*extract_operator_token(char *str, int *pos)
+/*
+ * The token runs from start, which may sit on the digits of `N>`, to the
+ * end of the operator at *pos
+ */
+char	*extract_operator_token(char *str, int *pos, int start)
 {
-	int		start;
 	char	*token;
 
-	start = *pos;
-	if ((str[*pos] == '>' || str[*pos] == '<') && (str[*pos] == str[*pos + 1]))
-	{
+	if (str[*pos] == '<' && str[*pos + 1] == '<' && str[*pos + 2] == '<')
+		(*pos) += 3;
+	else if ((str[*pos] == '>' || str[*pos] == '<')
+		&& (str[*pos] == str[*pos + 1] || str[*pos + 1] == '&'))
 		(*pos) += 2;
-		token = ft_strndup(&str[start], 2);
-	}
 	else
-	{
 		(*pos)++;
-		token = ft_strndup(&str[start], 1);
-	}
+	token = ft_strndup(&str[start], *pos - start);
 	if (!token)
 		ft_putstr_fd("minishell: memory allocation error\n", 2);
 	return (token);
 }
 
+static char	*skip_io_number(t_token *token)
+{
+	char	*op;
+
+	op = token->content;
+	while (ft_isdigit(*op))
+		op++;
+	if (op == token->content || (*op != '<' && *op != '>'))
+		return (token->content);
+	token->io_number = ft_atoi(token->content);
+	if (op - token->content > 4)
+		token->io_number = INT_MAX;
+	return (op);
+}
+
+static t_token_type	operator_type(char *op)
+{
+	if (ft_strcmp(op, "|") == 0)
+		return (TOKEN_PIPE);
+	if (ft_strcmp(op, ">") == 0)
+		return (TOKEN_REDIRECT_OUT);
+	if (ft_strcmp(op, "<") == 0)
+		return (TOKEN_REDIRECT_IN);
+	if (ft_strcmp(op, ">>") == 0)
+		return (TOKEN_APPEND);
+	if (ft_strcmp(op, "<<") == 0)
+		return (TOKEN_HEREDOC);
+	if (ft_strcmp(op, "<<<") == 0)
+		return (TOKEN_HERESTRING);
+	if (ft_strcmp(op, ">&") == 0)
+		return (TOKEN_DUP_OUT);
+	if (ft_strcmp(op, "<&") == 0)
+		return (TOKEN_DUP_IN);
+	if (ft_strcmp(op, ";") == 0)
+		return (TOKEN_SEMI);
+	if (ft_strcmp(op, "(") == 0)
+		return (TOKEN_LPAREN);
+	if (ft_strcmp(op, ")") == 0)
+		return (TOKEN_RPAREN);
+	return (TOKEN_WORD);
+}
+
 void	assign_token_types(t_token *tokens)
 {
 	t_token	*current;
@@ -45,18 +88,7 @@ void	assign_token_types(t_token *tokens)
 	current = tokens;
 	while (current)
 	{
-		if (ft_strcmp(current->content, "|") == 0)
-			current->type = TOKEN_PIPE;
-		else if (ft_strcmp(current->content, ">") == 0)
-			current->type = TOKEN_REDIRECT_OUT;
-		else if (ft_strcmp(current->content, "<") == 0)
-			current->type = TOKEN_REDIRECT_IN;
-		else if (ft_strcmp(current->content, ">>") == 0)
-			current->type = TOKEN_APPEND;
-		else if (ft_strcmp(current->content, "<<") == 0)
-			current->type = TOKEN_HEREDOC;
-		else
-			current->type = TOKEN_WORD;
+		current->type = operator_type(skip_io_number(current));
 		current = current->next;
 	}
 }
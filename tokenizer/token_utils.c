@@ -60,3 +60,11 @@ t_token	*token_utils_clean_tokens_return_null(t_token **tokens)
 	ft_token_clear(tokens, free);
 	return (NULL);
 }
+
+int	is_redirect_token(t_token_type type)
+{
+	return (type == TOKEN_REDIRECT_IN || type == TOKEN_REDIRECT_OUT
+		|| type == TOKEN_APPEND || type == TOKEN_HEREDOC
+		|| type == TOKEN_HERESTRING || type == TOKEN_DUP_IN
+		|| type == TOKEN_DUP_OUT);
+}
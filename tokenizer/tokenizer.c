@@ -12,17 +12,25 @@
 
 #include "../minishell.h"
 
+/*
+ * Digits written right before `<` or `>` name the descriptor to redirect
+ * and become part of the operator token
+ */
 int	process_operator(t_tokenizer *t)
 {
 	char	*token_content;
+	int		start;
 
-	if (t->i > t->start)
+	start = t->i;
+	if (is_io_number(t))
+		start = t->start;
+	else if (t->i > t->start)
 	{
 		token_content = extract_word_token(t->input, t->start, t->i);
 		if (!token_content || !add_token(t->tokens, token_content))
 			return (0);
 	}
-	token_content = extract_operator_token(t->input, &t->i);
+	token_content = extract_operator_token(t->input, &t->i, start);
 	if (!token_content || !add_token(t->tokens, token_content))
 		return (0);
 	t->start = t->i;
@@ -45,6 +53,20 @@ int	process_whitespace(t_tokenizer *t)
 
 int	process_normal_char(t_tokenizer *t)
 {
+	int	end;
+
+	if ((t->input[t->i] == '$' && (t->input[t->i + 1] == '('
+				|| t->input[t->i + 1] == '{'))
+		|| ((t->input[t->i] == '<' || t->input[t->i] == '>')
+			&& t->input[t->i + 1] == '('))
+	{
+		end = subst_end(t->input, t->i);
+		if (end > 0)
+		{
+			t->i = end;
+			return (1);
+		}
+	}
 	if (is_operator(t->input[t->i]))
 		return (process_operator(t));
 	else if (ft_isspace(t->input[t->i]))
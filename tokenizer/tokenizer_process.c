@@ -67,3 +67,16 @@ t_token	*tokenize_input(char *input)
 		return (clean_tokens_return_null(&tokens));
 	return (tokens);
 }
+
+int	is_io_number(t_tokenizer *t)
+{
+	int	k;
+
+	if (t->i == t->start
+		|| (t->input[t->i] != '<' && t->input[t->i] != '>'))
+		return (0);
+	k = t->start;
+	while (k < t->i && ft_isdigit(t->input[k]))
+		k++;
+	return (k == t->i);
+}
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_pass_utils.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:02:00 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 09:02:00 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * Sends iov with count descriptors attached as SCM_RIGHTS
+ */
+int	fd_send(int sock, struct iovec *iov, const int *fds, int count)
+{
+	struct msghdr	msg;
+	struct cmsghdr	*cm;
+	size_t			ctl[FD_PASS_CTL / sizeof(size_t)];
+
+	ft_bzero(&msg, sizeof(msg));
+	ft_bzero(ctl, sizeof(ctl));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ctl;
+	msg.msg_controllen = CMSG_SPACE(sizeof(int) * count);
+	cm = CMSG_FIRSTHDR(&msg);
+	cm->cmsg_level = SOL_SOCKET;
+	cm->cmsg_type = SCM_RIGHTS;
+	cm->cmsg_len = CMSG_LEN(sizeof(int) * count);
+	ft_memcpy(CMSG_DATA(cm), fds, sizeof(int) * count);
+	if (sendmsg(sock, &msg, MSG_NOSIGNAL) != (ssize_t) iov->iov_len)
+		return (-1);
+	return (0);
+}
+
+static void	close_received(struct cmsghdr *cm)
+{
+	int	fd;
+	int	n;
+
+	n = (cm->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+	while (n-- > 0)
+	{
+		ft_memcpy(&fd, CMSG_DATA(cm) + n * sizeof(int), sizeof(int));
+		close(fd);
+	}
+}
+
+/*
+ * Fills iov and fds from one message, the descriptors close-on-exec.
+ * Returns the bytes read, 0 at end of file, and -1 unless exactly count
+ * descriptors and a full iov arrived; any that did are closed then
+ */
+ssize_t	fd_receive(int sock, struct iovec *iov, int *fds, int count)
+{
+	struct msghdr	msg;
+	struct cmsghdr	*cm;
+	size_t			ctl[FD_PASS_CTL / sizeof(size_t)];
+	ssize_t			n;
+
+	ft_bzero(&msg, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ctl;
+	msg.msg_controllen = sizeof(ctl);
+	n = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC | MSG_WAITALL);
+	if (n <= 0)
+		return (n);
+	cm = CMSG_FIRSTHDR(&msg);
+	if (cm && cm->cmsg_type == SCM_RIGHTS
+		&& cm->cmsg_len == CMSG_LEN(sizeof(int) * count)
+		&& n == (ssize_t) iov->iov_len && !(msg.msg_flags & MSG_CTRUNC))
+		return (ft_memcpy(fds, CMSG_DATA(cm), sizeof(int) * count), n);
+	if (cm && cm->cmsg_type == SCM_RIGHTS)
+		close_received(cm);
+	return (-1);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   io_utils.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:00:57 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 13:00:57 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+int	write_all(int fd, const char *s, size_t len)
+{
+	ssize_t	n;
+
+	while (len > 0)
+	{
+		n = write(fd, s, len);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n < 0)
+			return (-1);
+		s += n;
+		len -= n;
+	}
+	return (0);
+}
+
+/*
+ * write_all for a socket whose peer may be gone: EPIPE is returned
+ * instead of raising SIGPIPE
+ */
+int	send_all(int sock, const char *s, size_t len)
+{
+	ssize_t	n;
+
+	while (len > 0)
+	{
+		n = send(sock, s, len, MSG_NOSIGNAL);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n < 0)
+			return (-1);
+		s += n;
+		len -= n;
+	}
+	return (0);
+}
+
+/*
+ * Reads exactly len bytes; end of file before that is an error
+ */
+int	read_all(int fd, char *s, size_t len)
+{
+	ssize_t	n;
+
+	while (len > 0)
+	{
+		n = read(fd, s, len);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (-1);
+		s += n;
+		len -= n;
+	}
+	return (0);
+}
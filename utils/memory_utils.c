@@ -65,12 +65,12 @@ void	free_command(t_command *cmd)
 	while (redir)
 	{
 		next_redir = redir->next;
-		if (redir->type == TOKEN_HEREDOC && redir->heredoc_fd >= 0)
-			safe_close(&redir->heredoc_fd);
+		safe_close(&redir->heredoc_fd);
 		safe_free((void **)&redir->file);
 		safe_free((void **)&redir);
 		redir = next_redir;
 	}
+	free_sequence(cmd->group);
 	safe_free((void **)&cmd);
 }
 
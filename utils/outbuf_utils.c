@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   outbuf_utils.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:54:37 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 18:54:37 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+/*
+ * One buffer serves every builtin: only one runs at a time, takes it
+ * once on entry and flushes it before returning
+ */
+t_outbuf	*builtin_out(void)
+{
+	static t_outbuf	out;
+
+	out.fd = STDOUT_FILENO;
+	out.failed = 0;
+	out.len = 0;
+	return (&out);
+}
+
+int	outbuf_flush(t_outbuf *out)
+{
+	if (out->len > 0 && !out->failed
+		&& write_all(out->fd, out->data, out->len) == -1)
+		out->failed = errno;
+	out->len = 0;
+	return (-(out->failed != 0));
+}
+
+/*
+ * Text larger than the buffer goes out in one write once the buffer
+ * ahead of it is flushed
+ */
+void	outbuf_put(t_outbuf *out, const char *s, size_t len)
+{
+	if (out->len + len > OUTBUF_SIZE)
+		outbuf_flush(out);
+	if (len >= OUTBUF_SIZE)
+	{
+		if (!out->failed && write_all(out->fd, s, len) == -1)
+			out->failed = errno;
+		return ;
+	}
+	ft_memcpy(out->data + out->len, s, len);
+	out->len += len;
+}
+
+void	outbuf_fill(t_outbuf *out, char c, int count)
+{
+	int	n;
+
+	while (count > 0)
+	{
+		if (out->len == OUTBUF_SIZE)
+			outbuf_flush(out);
+		n = OUTBUF_SIZE - out->len;
+		if (n > count)
+			n = count;
+		ft_memset(out->data + out->len, c, n);
+		out->len += n;
+		count -= n;
+	}
+}
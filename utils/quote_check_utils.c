@@ -57,3 +57,26 @@ int	is_content_quoted(char *content)
 	}
 	return (quoted);
 }
+
+/*
+ * Index of the first `c` outside quotes, or -1
+ */
+int	find_unquoted(const char *s, char c)
+{
+	char	quote;
+	int		i;
+
+	quote = 0;
+	i = 0;
+	while (s[i])
+	{
+		if (!quote && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (quote && s[i] == quote)
+			quote = 0;
+		else if (!quote && s[i] == c)
+			return (i);
+		i++;
+	}
+	return (-1);
+}
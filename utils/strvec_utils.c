@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strvec_utils.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:32:26 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 11:32:26 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+static int	strvec_grow(t_strvec *v)
+{
+	char	**items;
+	int		cap;
+
+	cap = v->cap * 2;
+	if (cap < 16)
+		cap = 16;
+	items = malloc(sizeof(char *) * (cap + 1));
+	if (!items)
+		return (0);
+	if (v->items)
+		ft_memcpy(items, v->items, sizeof(char *) * v->count);
+	items[v->count] = NULL;
+	safe_free((void **)&v->items);
+	v->items = items;
+	v->cap = cap;
+	return (1);
+}
+
+int	strvec_push(t_strvec *v, char *s)
+{
+	if (!s)
+		return (0);
+	if (v->count >= v->cap && !strvec_grow(v))
+		return (0);
+	v->items[v->count++] = s;
+	v->items[v->count] = NULL;
+	return (1);
+}
+
+void	strvec_free(t_strvec *v)
+{
+	int	i;
+
+	i = 0;
+	while (v->items && i < v->count)
+		safe_free((void **)&v->items[i++]);
+	safe_free((void **)&v->items);
+	v->count = 0;
+	v->cap = 0;
+}
+
+static int	partition_strings(char **arr, int n)
+{
+	char	*pivot;
+	char	*tmp;
+	int		i;
+	int		j;
+
+	tmp = arr[n / 2];
+	arr[n / 2] = arr[n - 1];
+	arr[n - 1] = tmp;
+	pivot = arr[n - 1];
+	i = 0;
+	j = -1;
+	while (++j < n - 1)
+	{
+		if (ft_strcmp(arr[j], pivot) < 0)
+		{
+			tmp = arr[i];
+			arr[i++] = arr[j];
+			arr[j] = tmp;
+		}
+	}
+	arr[n - 1] = arr[i];
+	arr[i] = pivot;
+	return (i);
+}
+
+void	sort_strings(char **arr, int n)
+{
+	int	p;
+
+	while (n > 1)
+	{
+		p = partition_strings(arr, n);
+		if (p < n - p - 1)
+		{
+			sort_strings(arr, p);
+			arr += p + 1;
+			n -= p + 1;
+		}
+		else
+		{
+			sort_strings(arr + p + 1, n - p - 1);
+			n = p;
+		}
+	}
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   subst_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yrachidi <yrachidi@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:28:04 by yrachidi          #+#    #+#             */
+/*   Updated: 2026/10/19 15:28:04 by yrachidi         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../minishell.h"
+
+int	skip_quoted_text(const char *s, int i)
+{
+	char	quote;
+
+	quote = s[i++];
+	while (s[i] && s[i] != quote)
+		i++;
+	if (!s[i])
+		return (-1);
+	return (i);
+}
+
+/*
+ * s[i] is the `$` (or `<`/`>`) that opens a parenthesised substitution,
+ * or the `$` of a `${...}` parameter expansion. Returns the index just
+ * past the matching `)` or `}`, or -1 when unbalanced.
+ */
+int	subst_end(const char *s, int i)
+{
+	char	open;
+	char	close;
+	int		depth;
+
+	open = s[++i];
+	close = ')';
+	if (open == '{')
+		close = '}';
+	depth = 0;
+	while (s[i])
+	{
+		if (s[i] == '\'' || s[i] == '"')
+			i = skip_quoted_text(s, i);
+		if (i < 0)
+			return (-1);
+		if (s[i] == open)
+			depth++;
+		else if (s[i] == close && --depth == 0)
+			return (i + 1);
+		i++;
+	}
+	return (-1);
+}
+
+/*
+ * Makes room for at least `want` more bytes plus a terminator, doubling
+ * the capacity so a long capture costs a logarithmic number of copies
+ */
+int	subst_buf_reserve(t_subst_buf *buf, size_t want)
+{
+	char	*data;
+	size_t	cap;
+
+	if (buf->cap - buf->len > want)
+		return (1);
+	cap = buf->cap * 2;
+	if (cap < SUBST_BUF_MIN)
+		cap = SUBST_BUF_MIN;
+	while (cap - buf->len <= want)
+		cap *= 2;
+	data = malloc(cap);
+	if (!data)
+		return (0);
+	if (buf->data)
+		ft_memcpy(data, buf->data, buf->len);
+	safe_free((void **)&buf->data);
+	buf->data = data;
+	buf->cap = cap;
+	return (1);
+}
+
+/*
+ * Reads `fd` to end of file, each read filling whatever room the buffer
+ * has left, and stops early on Ctrl-C. fd may be non-blocking. What was
+ * read is NUL-terminated either way; returns 1 when all of it was
+ */
+int	subst_read_fd(int fd, t_subst_buf *buf)
+{
+	ssize_t	n;
+
+	n = -1;
+	while (subst_buf_reserve(buf, SUBST_BUF_MIN / 2) && wait_readable(fd) == 0)
+	{
+		n = read(fd, buf->data + buf->len, buf->cap - buf->len - 1);
+		if (n == 0)
+			break ;
+		if (n < 0 && errno != EINTR && errno != EAGAIN)
+			break ;
+		if (n > 0)
+			buf->len += n;
+		n = -1;
+	}
+	if (buf->data)
+		buf->data[buf->len] = '\0';
+	return (n == 0);
+}
+
+/*
+ * Unquoted expansions are split on blanks; tabs and newlines (as left by
+ * command substitution) separate fields just like spaces
+ */
+void	fold_field_separators(char *s)
+{
+	while (s && *s)
+	{
+		if (*s == '\t' || *s == '\n')
+			*s = ' ';
+		s++;
+	}
+}